@@ -6,20 +6,38 @@
 C_SRCS += \
 ../advertise.c \
 ../app.c \
+../bt_dispatch.c \
+../bt_subscriptions.c \
+../clock_cal.c \
+../energy_estimator.c \
 ../main.c \
-../sl_gatt_service_device_information_override.c 
+../sl_gatt_service_device_information_override.c \
+../swo_stream.c \
+../tx_power.c 
 
 OBJS += \
 ./advertise.o \
 ./app.o \
+./bt_dispatch.o \
+./bt_subscriptions.o \
+./clock_cal.o \
+./energy_estimator.o \
 ./main.o \
-./sl_gatt_service_device_information_override.o 
+./sl_gatt_service_device_information_override.o \
+./swo_stream.o \
+./tx_power.o 
 
 C_DEPS += \
 ./advertise.d \
 ./app.d \
+./bt_dispatch.d \
+./bt_subscriptions.d \
+./clock_cal.d \
+./energy_estimator.d \
 ./main.d \
-./sl_gatt_service_device_information_override.d 
+./sl_gatt_service_device_information_override.d \
+./swo_stream.d \
+./tx_power.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -37,6 +55,34 @@ app.o: ../app.c subdir.mk
 	@echo 'Finished building: $<'
 	@echo ' '
 
+bt_dispatch.o: ../bt_dispatch.c subdir.mk
+	@echo 'Building file: $<'
+	@echo 'Invoking: GNU ARM C Compiler'
+	arm-none-eabi-gcc -g -gdwarf-2 -mcpu=cortex-m33 -mthumb -std=c18 '-DEFR32BG22C224F512IM40=1' '-DSL_CODE_COMPONENT_SYSTEM=system' '-DSL_APP_PROPERTIES=1' '-DBOOTLOADER_APPLOADER=1' '-DHARDWARE_BOARD_DEFAULT_RF_BAND_2400=1' '-DHARDWARE_BOARD_SUPPORTS_1_RF_BAND=1' '-DHARDWARE_BOARD_SUPPORTS_RF_BAND_2400=1' '-DHFXO_FREQ=38400000' '-DSL_BOARD_NAME="BRD4184A"' '-DSL_BOARD_REV="A02"' '-DSL_CODE_COMPONENT_CLOCK_MANAGER=clock_manager' '-DSL_COMPONENT_CATALOG_PRESENT=1' '-DSL_CODE_COMPONENT_DEVICE_PERIPHERAL=device_peripheral' '-DSL_CODE_COMPONENT_DMADRV=dmadrv' '-DSL_CODE_COMPONENT_GPIO=gpio' '-DSL_CODE_COMPONENT_HAL_COMMON=hal_common' '-DSL_CODE_COMPONENT_HAL_GPIO=hal_gpio' '-DSL_CODE_COMPONENT_INTERRUPT_MANAGER=interrupt_manager' '-DCMSIS_NVIC_VIRTUAL=1' '-DCMSIS_NVIC_VIRTUAL_HEADER_FILE="cmsis_nvic_virtual.h"' '-DMBEDTLS_CONFIG_FILE=<sl_mbedtls_config.h>' '-DSL_CODE_COMPONENT_POWER_MANAGER=power_manager' '-DMBEDTLS_PSA_CRYPTO_CONFIG_FILE=<psa_crypto_config.h>' '-DSL_RAIL_LIB_MULTIPROTOCOL_SUPPORT=0' '-DSL_RAIL_UTIL_PA_CONFIG_HEADER=<sl_rail_util_pa_config.h>' '-DSL_CODE_COMPONENT_SE_MANAGER=se_manager' '-DSL_CODE_COMPONENT_CORE=core' '-DSL_RAIL_3_API=1' '-DSL_CODE_COMPONENT_SLEEPTIMER=sleeptimer' '-DSL_CODE_COMPONENT_SLI_CRYPTO=sli_crypto' '-DSLI_RADIOAES_REQUIRES_MASKING=1' '-DSL_CODE_COMPONENT_SLI_PROTOCOL_CRYPTO=sli_protocol_crypto' '-DSL_CODE_COMPONENT_PSEC_OSAL=psec_osal' -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\config" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\config\btconf" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\autogen" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\brd4184a" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\driver\hall" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\driver\imu" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\Device\SiliconLabs\EFR32BG22\Include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_assert" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_log" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_timer" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_timer\bm" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\protocol\bluetooth\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\common\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\protocol\bluetooth\bgcommon\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\protocol\bluetooth\bgstack\ll\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\board\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\bootloader" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\bootloader\api" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\bootloader\core\flash" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\button\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\clock_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\clock_manager\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\CMSIS\Core\Include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\configuration_over_swo\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\debug\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\device_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\device_init\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\dmadrv\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\dmadrv\inc\s2_signals" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\common\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emlib\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_aio" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_battery" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_device_information_override" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_hall" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_imu" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_light" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_rht" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\gpio\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\peripheral\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\i2cspm\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\icm20648\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\imu\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\in_place_ota_dfu" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\interrupt_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\interrupt_manager\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\interrupt_manager\inc\arm" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\iostream\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\leddrv\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\crypto_ip\libcryptosoc\include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\crypto_ip\libcryptosoc\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_mbedtls_support\config" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_mbedtls_support\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\mbedtls\include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\mbedtls\library" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\memory_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\memory_manager\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\memory_manager\profiler\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\mpu\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\mx25_flash_shutdown\inc\sl_mx25_flash_shutdown_usart" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\nvm3\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\nvm3\config" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\power_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\power_supply" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\printf" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\printf\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_psa_driver\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\common" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\ble" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\ieee802154" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\wmbus" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\zwave" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\chip\efr32\efr32xg2x" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\sidewalk" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\pa-conversions" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\pa-conversions\efr32xg22" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\rail_util_power_manager_init" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\rail_util_pti" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\se_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\sensor_light" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\sensor_rht" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\si1133\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\si70xx\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\si7210\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\sl_main\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\sl_main\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\sleeptimer\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sli_crypto\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_protocol_crypto\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sli_psec_osal\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\udelay\inc" -Os -Wall -Wextra -ffunction-sections -fdata-sections -mcmse -mfpu=fpv5-sp-d16 -mfloat-abi=hard -fno-builtin-printf -fno-builtin-sprintf -fno-lto --specs=nano.specs -c -fmessage-length=0 -MMD -MP -MF"bt_dispatch.d" -MT"$@" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
+bt_subscriptions.o: ../bt_subscriptions.c subdir.mk
+	@echo 'Building file: $<'
+	@echo 'Invoking: GNU ARM C Compiler'
+	arm-none-eabi-gcc -g -gdwarf-2 -mcpu=cortex-m33 -mthumb -std=c18 '-DEFR32BG22C224F512IM40=1' '-DSL_CODE_COMPONENT_SYSTEM=system' '-DSL_APP_PROPERTIES=1' '-DBOOTLOADER_APPLOADER=1' '-DHARDWARE_BOARD_DEFAULT_RF_BAND_2400=1' '-DHARDWARE_BOARD_SUPPORTS_1_RF_BAND=1' '-DHARDWARE_BOARD_SUPPORTS_RF_BAND_2400=1' '-DHFXO_FREQ=38400000' '-DSL_BOARD_NAME="BRD4184A"' '-DSL_BOARD_REV="A02"' '-DSL_CODE_COMPONENT_CLOCK_MANAGER=clock_manager' '-DSL_COMPONENT_CATALOG_PRESENT=1' '-DSL_CODE_COMPONENT_DEVICE_PERIPHERAL=device_peripheral' '-DSL_CODE_COMPONENT_DMADRV=dmadrv' '-DSL_CODE_COMPONENT_GPIO=gpio' '-DSL_CODE_COMPONENT_HAL_COMMON=hal_common' '-DSL_CODE_COMPONENT_HAL_GPIO=hal_gpio' '-DSL_CODE_COMPONENT_INTERRUPT_MANAGER=interrupt_manager' '-DCMSIS_NVIC_VIRTUAL=1' '-DCMSIS_NVIC_VIRTUAL_HEADER_FILE="cmsis_nvic_virtual.h"' '-DMBEDTLS_CONFIG_FILE=<sl_mbedtls_config.h>' '-DSL_CODE_COMPONENT_POWER_MANAGER=power_manager' '-DMBEDTLS_PSA_CRYPTO_CONFIG_FILE=<psa_crypto_config.h>' '-DSL_RAIL_LIB_MULTIPROTOCOL_SUPPORT=0' '-DSL_RAIL_UTIL_PA_CONFIG_HEADER=<sl_rail_util_pa_config.h>' '-DSL_CODE_COMPONENT_SE_MANAGER=se_manager' '-DSL_CODE_COMPONENT_CORE=core' '-DSL_RAIL_3_API=1' '-DSL_CODE_COMPONENT_SLEEPTIMER=sleeptimer' '-DSL_CODE_COMPONENT_SLI_CRYPTO=sli_crypto' '-DSLI_RADIOAES_REQUIRES_MASKING=1' '-DSL_CODE_COMPONENT_SLI_PROTOCOL_CRYPTO=sli_protocol_crypto' '-DSL_CODE_COMPONENT_PSEC_OSAL=psec_osal' -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\config" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\config\btconf" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\autogen" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\brd4184a" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\driver\hall" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\driver\imu" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\Device\SiliconLabs\EFR32BG22\Include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_assert" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_log" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_timer" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_timer\bm" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\protocol\bluetooth\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\common\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\protocol\bluetooth\bgcommon\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\protocol\bluetooth\bgstack\ll\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\board\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\bootloader" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\bootloader\api" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\bootloader\core\flash" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\button\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\clock_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\clock_manager\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\CMSIS\Core\Include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\configuration_over_swo\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\debug\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\device_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\device_init\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\dmadrv\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\dmadrv\inc\s2_signals" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\common\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emlib\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_aio" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_battery" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_device_information_override" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_hall" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_imu" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_light" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_rht" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\gpio\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\peripheral\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\i2cspm\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\icm20648\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\imu\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\in_place_ota_dfu" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\interrupt_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\interrupt_manager\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\interrupt_manager\inc\arm" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\iostream\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\leddrv\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\crypto_ip\libcryptosoc\include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\crypto_ip\libcryptosoc\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_mbedtls_support\config" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_mbedtls_support\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\mbedtls\include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\mbedtls\library" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\memory_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\memory_manager\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\memory_manager\profiler\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\mpu\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\mx25_flash_shutdown\inc\sl_mx25_flash_shutdown_usart" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\nvm3\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\nvm3\config" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\power_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\power_supply" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\printf" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\printf\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_psa_driver\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\common" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\ble" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\ieee802154" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\wmbus" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\zwave" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\chip\efr32\efr32xg2x" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\sidewalk" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\pa-conversions" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\pa-conversions\efr32xg22" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\rail_util_power_manager_init" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\rail_util_pti" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\se_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\sensor_light" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\sensor_rht" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\si1133\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\si70xx\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\si7210\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\sl_main\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\sl_main\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\sleeptimer\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sli_crypto\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_protocol_crypto\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sli_psec_osal\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\udelay\inc" -Os -Wall -Wextra -ffunction-sections -fdata-sections -mcmse -mfpu=fpv5-sp-d16 -mfloat-abi=hard -fno-builtin-printf -fno-builtin-sprintf -fno-lto --specs=nano.specs -c -fmessage-length=0 -MMD -MP -MF"bt_subscriptions.d" -MT"$@" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
+clock_cal.o: ../clock_cal.c subdir.mk
+	@echo 'Building file: $<'
+	@echo 'Invoking: GNU ARM C Compiler'
+	arm-none-eabi-gcc -g -gdwarf-2 -mcpu=cortex-m33 -mthumb -std=c18 '-DEFR32BG22C224F512IM40=1' '-DSL_CODE_COMPONENT_SYSTEM=system' '-DSL_APP_PROPERTIES=1' '-DBOOTLOADER_APPLOADER=1' '-DHARDWARE_BOARD_DEFAULT_RF_BAND_2400=1' '-DHARDWARE_BOARD_SUPPORTS_1_RF_BAND=1' '-DHARDWARE_BOARD_SUPPORTS_RF_BAND_2400=1' '-DHFXO_FREQ=38400000' '-DSL_BOARD_NAME="BRD4184A"' '-DSL_BOARD_REV="A02"' '-DSL_CODE_COMPONENT_CLOCK_MANAGER=clock_manager' '-DSL_COMPONENT_CATALOG_PRESENT=1' '-DSL_CODE_COMPONENT_DEVICE_PERIPHERAL=device_peripheral' '-DSL_CODE_COMPONENT_DMADRV=dmadrv' '-DSL_CODE_COMPONENT_GPIO=gpio' '-DSL_CODE_COMPONENT_HAL_COMMON=hal_common' '-DSL_CODE_COMPONENT_HAL_GPIO=hal_gpio' '-DSL_CODE_COMPONENT_INTERRUPT_MANAGER=interrupt_manager' '-DCMSIS_NVIC_VIRTUAL=1' '-DCMSIS_NVIC_VIRTUAL_HEADER_FILE="cmsis_nvic_virtual.h"' '-DMBEDTLS_CONFIG_FILE=<sl_mbedtls_config.h>' '-DSL_CODE_COMPONENT_POWER_MANAGER=power_manager' '-DMBEDTLS_PSA_CRYPTO_CONFIG_FILE=<psa_crypto_config.h>' '-DSL_RAIL_LIB_MULTIPROTOCOL_SUPPORT=0' '-DSL_RAIL_UTIL_PA_CONFIG_HEADER=<sl_rail_util_pa_config.h>' '-DSL_CODE_COMPONENT_SE_MANAGER=se_manager' '-DSL_CODE_COMPONENT_CORE=core' '-DSL_RAIL_3_API=1' '-DSL_CODE_COMPONENT_SLEEPTIMER=sleeptimer' '-DSL_CODE_COMPONENT_SLI_CRYPTO=sli_crypto' '-DSLI_RADIOAES_REQUIRES_MASKING=1' '-DSL_CODE_COMPONENT_SLI_PROTOCOL_CRYPTO=sli_protocol_crypto' '-DSL_CODE_COMPONENT_PSEC_OSAL=psec_osal' -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\config" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\config\btconf" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\autogen" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\brd4184a" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\driver\hall" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\driver\imu" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\Device\SiliconLabs\EFR32BG22\Include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_assert" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_log" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_timer" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_timer\bm" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\protocol\bluetooth\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\common\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\protocol\bluetooth\bgcommon\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\protocol\bluetooth\bgstack\ll\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\board\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\bootloader" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\bootloader\api" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\bootloader\core\flash" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\button\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\clock_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\clock_manager\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\CMSIS\Core\Include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\configuration_over_swo\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\debug\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\device_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\device_init\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\dmadrv\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\dmadrv\inc\s2_signals" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\common\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emlib\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_aio" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_battery" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_device_information_override" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_hall" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_imu" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_light" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_rht" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\gpio\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\peripheral\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\i2cspm\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\icm20648\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\imu\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\in_place_ota_dfu" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\interrupt_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\interrupt_manager\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\interrupt_manager\inc\arm" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\iostream\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\leddrv\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\crypto_ip\libcryptosoc\include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\crypto_ip\libcryptosoc\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_mbedtls_support\config" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_mbedtls_support\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\mbedtls\include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\mbedtls\library" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\memory_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\memory_manager\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\memory_manager\profiler\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\mpu\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\mx25_flash_shutdown\inc\sl_mx25_flash_shutdown_usart" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\nvm3\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\nvm3\config" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\power_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\power_supply" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\printf" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\printf\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_psa_driver\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\common" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\ble" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\ieee802154" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\wmbus" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\zwave" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\chip\efr32\efr32xg2x" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\sidewalk" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\pa-conversions" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\pa-conversions\efr32xg22" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\rail_util_power_manager_init" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\rail_util_pti" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\se_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\sensor_light" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\sensor_rht" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\si1133\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\si70xx\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\si7210\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\sl_main\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\sl_main\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\sleeptimer\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sli_crypto\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_protocol_crypto\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sli_psec_osal\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\udelay\inc" -Os -Wall -Wextra -ffunction-sections -fdata-sections -mcmse -mfpu=fpv5-sp-d16 -mfloat-abi=hard -fno-builtin-printf -fno-builtin-sprintf -fno-lto --specs=nano.specs -c -fmessage-length=0 -MMD -MP -MF"clock_cal.d" -MT"$@" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
+energy_estimator.o: ../energy_estimator.c subdir.mk
+	@echo 'Building file: $<'
+	@echo 'Invoking: GNU ARM C Compiler'
+	arm-none-eabi-gcc -g -gdwarf-2 -mcpu=cortex-m33 -mthumb -std=c18 '-DEFR32BG22C224F512IM40=1' '-DSL_CODE_COMPONENT_SYSTEM=system' '-DSL_APP_PROPERTIES=1' '-DBOOTLOADER_APPLOADER=1' '-DHARDWARE_BOARD_DEFAULT_RF_BAND_2400=1' '-DHARDWARE_BOARD_SUPPORTS_1_RF_BAND=1' '-DHARDWARE_BOARD_SUPPORTS_RF_BAND_2400=1' '-DHFXO_FREQ=38400000' '-DSL_BOARD_NAME="BRD4184A"' '-DSL_BOARD_REV="A02"' '-DSL_CODE_COMPONENT_CLOCK_MANAGER=clock_manager' '-DSL_COMPONENT_CATALOG_PRESENT=1' '-DSL_CODE_COMPONENT_DEVICE_PERIPHERAL=device_peripheral' '-DSL_CODE_COMPONENT_DMADRV=dmadrv' '-DSL_CODE_COMPONENT_GPIO=gpio' '-DSL_CODE_COMPONENT_HAL_COMMON=hal_common' '-DSL_CODE_COMPONENT_HAL_GPIO=hal_gpio' '-DSL_CODE_COMPONENT_INTERRUPT_MANAGER=interrupt_manager' '-DCMSIS_NVIC_VIRTUAL=1' '-DCMSIS_NVIC_VIRTUAL_HEADER_FILE="cmsis_nvic_virtual.h"' '-DMBEDTLS_CONFIG_FILE=<sl_mbedtls_config.h>' '-DSL_CODE_COMPONENT_POWER_MANAGER=power_manager' '-DMBEDTLS_PSA_CRYPTO_CONFIG_FILE=<psa_crypto_config.h>' '-DSL_RAIL_LIB_MULTIPROTOCOL_SUPPORT=0' '-DSL_RAIL_UTIL_PA_CONFIG_HEADER=<sl_rail_util_pa_config.h>' '-DSL_CODE_COMPONENT_SE_MANAGER=se_manager' '-DSL_CODE_COMPONENT_CORE=core' '-DSL_RAIL_3_API=1' '-DSL_CODE_COMPONENT_SLEEPTIMER=sleeptimer' '-DSL_CODE_COMPONENT_SLI_CRYPTO=sli_crypto' '-DSLI_RADIOAES_REQUIRES_MASKING=1' '-DSL_CODE_COMPONENT_SLI_PROTOCOL_CRYPTO=sli_protocol_crypto' '-DSL_CODE_COMPONENT_PSEC_OSAL=psec_osal' -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\config" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\config\btconf" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\autogen" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\brd4184a" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\driver\hall" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\driver\imu" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\Device\SiliconLabs\EFR32BG22\Include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_assert" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_log" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_timer" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_timer\bm" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\protocol\bluetooth\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\common\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\protocol\bluetooth\bgcommon\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\protocol\bluetooth\bgstack\ll\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\board\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\bootloader" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\bootloader\api" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\bootloader\core\flash" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\button\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\clock_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\clock_manager\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\CMSIS\Core\Include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\configuration_over_swo\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\debug\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\device_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\device_init\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\dmadrv\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\dmadrv\inc\s2_signals" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\common\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emlib\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_aio" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_battery" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_device_information_override" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_hall" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_imu" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_light" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_rht" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\gpio\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\peripheral\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\i2cspm\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\icm20648\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\imu\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\in_place_ota_dfu" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\interrupt_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\interrupt_manager\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\interrupt_manager\inc\arm" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\iostream\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\leddrv\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\crypto_ip\libcryptosoc\include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\crypto_ip\libcryptosoc\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_mbedtls_support\config" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_mbedtls_support\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\mbedtls\include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\mbedtls\library" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\memory_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\memory_manager\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\memory_manager\profiler\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\mpu\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\mx25_flash_shutdown\inc\sl_mx25_flash_shutdown_usart" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\nvm3\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\nvm3\config" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\power_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\power_supply" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\printf" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\printf\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_psa_driver\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\common" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\ble" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\ieee802154" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\wmbus" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\zwave" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\chip\efr32\efr32xg2x" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\sidewalk" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\pa-conversions" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\pa-conversions\efr32xg22" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\rail_util_power_manager_init" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\rail_util_pti" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\se_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\sensor_light" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\sensor_rht" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\si1133\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\si70xx\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\si7210\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\sl_main\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\sl_main\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\sleeptimer\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sli_crypto\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_protocol_crypto\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sli_psec_osal\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\udelay\inc" -Os -Wall -Wextra -ffunction-sections -fdata-sections -mcmse -mfpu=fpv5-sp-d16 -mfloat-abi=hard -fno-builtin-printf -fno-builtin-sprintf -fno-lto --specs=nano.specs -c -fmessage-length=0 -MMD -MP -MF"energy_estimator.d" -MT"$@" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
 main.o: ../main.c subdir.mk
 	@echo 'Building file: $<'
 	@echo 'Invoking: GNU ARM C Compiler'
@@ -51,4 +97,18 @@ sl_gatt_service_device_information_override.o: ../sl_gatt_service_device_informa
 	@echo 'Finished building: $<'
 	@echo ' '
 
+swo_stream.o: ../swo_stream.c subdir.mk
+	@echo 'Building file: $<'
+	@echo 'Invoking: GNU ARM C Compiler'
+	arm-none-eabi-gcc -g -gdwarf-2 -mcpu=cortex-m33 -mthumb -std=c18 '-DEFR32BG22C224F512IM40=1' '-DSL_CODE_COMPONENT_SYSTEM=system' '-DSL_APP_PROPERTIES=1' '-DBOOTLOADER_APPLOADER=1' '-DHARDWARE_BOARD_DEFAULT_RF_BAND_2400=1' '-DHARDWARE_BOARD_SUPPORTS_1_RF_BAND=1' '-DHARDWARE_BOARD_SUPPORTS_RF_BAND_2400=1' '-DHFXO_FREQ=38400000' '-DSL_BOARD_NAME="BRD4184A"' '-DSL_BOARD_REV="A02"' '-DSL_CODE_COMPONENT_CLOCK_MANAGER=clock_manager' '-DSL_COMPONENT_CATALOG_PRESENT=1' '-DSL_CODE_COMPONENT_DEVICE_PERIPHERAL=device_peripheral' '-DSL_CODE_COMPONENT_DMADRV=dmadrv' '-DSL_CODE_COMPONENT_GPIO=gpio' '-DSL_CODE_COMPONENT_HAL_COMMON=hal_common' '-DSL_CODE_COMPONENT_HAL_GPIO=hal_gpio' '-DSL_CODE_COMPONENT_INTERRUPT_MANAGER=interrupt_manager' '-DCMSIS_NVIC_VIRTUAL=1' '-DCMSIS_NVIC_VIRTUAL_HEADER_FILE="cmsis_nvic_virtual.h"' '-DMBEDTLS_CONFIG_FILE=<sl_mbedtls_config.h>' '-DSL_CODE_COMPONENT_POWER_MANAGER=power_manager' '-DMBEDTLS_PSA_CRYPTO_CONFIG_FILE=<psa_crypto_config.h>' '-DSL_RAIL_LIB_MULTIPROTOCOL_SUPPORT=0' '-DSL_RAIL_UTIL_PA_CONFIG_HEADER=<sl_rail_util_pa_config.h>' '-DSL_CODE_COMPONENT_SE_MANAGER=se_manager' '-DSL_CODE_COMPONENT_CORE=core' '-DSL_RAIL_3_API=1' '-DSL_CODE_COMPONENT_SLEEPTIMER=sleeptimer' '-DSL_CODE_COMPONENT_SLI_CRYPTO=sli_crypto' '-DSLI_RADIOAES_REQUIRES_MASKING=1' '-DSL_CODE_COMPONENT_SLI_PROTOCOL_CRYPTO=sli_protocol_crypto' '-DSL_CODE_COMPONENT_PSEC_OSAL=psec_osal' -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\config" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\config\btconf" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\autogen" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\brd4184a" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\driver\hall" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\driver\imu" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\Device\SiliconLabs\EFR32BG22\Include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_assert" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_log" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_timer" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_timer\bm" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\protocol\bluetooth\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\common\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\protocol\bluetooth\bgcommon\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\protocol\bluetooth\bgstack\ll\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\board\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\bootloader" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\bootloader\api" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\bootloader\core\flash" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\button\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\clock_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\clock_manager\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\CMSIS\Core\Include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\configuration_over_swo\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\debug\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\device_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\device_init\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\dmadrv\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\dmadrv\inc\s2_signals" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\common\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emlib\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_aio" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_battery" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_device_information_override" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_hall" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_imu" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_light" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_rht" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\gpio\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\peripheral\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\i2cspm\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\icm20648\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\imu\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\in_place_ota_dfu" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\interrupt_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\interrupt_manager\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\interrupt_manager\inc\arm" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\iostream\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\leddrv\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\crypto_ip\libcryptosoc\include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\crypto_ip\libcryptosoc\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_mbedtls_support\config" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_mbedtls_support\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\mbedtls\include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\mbedtls\library" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\memory_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\memory_manager\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\memory_manager\profiler\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\mpu\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\mx25_flash_shutdown\inc\sl_mx25_flash_shutdown_usart" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\nvm3\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\nvm3\config" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\power_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\power_supply" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\printf" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\printf\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_psa_driver\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\common" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\ble" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\ieee802154" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\wmbus" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\zwave" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\chip\efr32\efr32xg2x" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\sidewalk" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\pa-conversions" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\pa-conversions\efr32xg22" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\rail_util_power_manager_init" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\rail_util_pti" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\se_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\sensor_light" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\sensor_rht" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\si1133\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\si70xx\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\si7210\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\sl_main\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\sl_main\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\sleeptimer\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sli_crypto\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_protocol_crypto\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sli_psec_osal\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\udelay\inc" -Os -Wall -Wextra -ffunction-sections -fdata-sections -mcmse -mfpu=fpv5-sp-d16 -mfloat-abi=hard -fno-builtin-printf -fno-builtin-sprintf -fno-lto --specs=nano.specs -c -fmessage-length=0 -MMD -MP -MF"swo_stream.d" -MT"$@" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
+tx_power.o: ../tx_power.c subdir.mk
+	@echo 'Building file: $<'
+	@echo 'Invoking: GNU ARM C Compiler'
+	arm-none-eabi-gcc -g -gdwarf-2 -mcpu=cortex-m33 -mthumb -std=c18 '-DEFR32BG22C224F512IM40=1' '-DSL_CODE_COMPONENT_SYSTEM=system' '-DSL_APP_PROPERTIES=1' '-DBOOTLOADER_APPLOADER=1' '-DHARDWARE_BOARD_DEFAULT_RF_BAND_2400=1' '-DHARDWARE_BOARD_SUPPORTS_1_RF_BAND=1' '-DHARDWARE_BOARD_SUPPORTS_RF_BAND_2400=1' '-DHFXO_FREQ=38400000' '-DSL_BOARD_NAME="BRD4184A"' '-DSL_BOARD_REV="A02"' '-DSL_CODE_COMPONENT_CLOCK_MANAGER=clock_manager' '-DSL_COMPONENT_CATALOG_PRESENT=1' '-DSL_CODE_COMPONENT_DEVICE_PERIPHERAL=device_peripheral' '-DSL_CODE_COMPONENT_DMADRV=dmadrv' '-DSL_CODE_COMPONENT_GPIO=gpio' '-DSL_CODE_COMPONENT_HAL_COMMON=hal_common' '-DSL_CODE_COMPONENT_HAL_GPIO=hal_gpio' '-DSL_CODE_COMPONENT_INTERRUPT_MANAGER=interrupt_manager' '-DCMSIS_NVIC_VIRTUAL=1' '-DCMSIS_NVIC_VIRTUAL_HEADER_FILE="cmsis_nvic_virtual.h"' '-DMBEDTLS_CONFIG_FILE=<sl_mbedtls_config.h>' '-DSL_CODE_COMPONENT_POWER_MANAGER=power_manager' '-DMBEDTLS_PSA_CRYPTO_CONFIG_FILE=<psa_crypto_config.h>' '-DSL_RAIL_LIB_MULTIPROTOCOL_SUPPORT=0' '-DSL_RAIL_UTIL_PA_CONFIG_HEADER=<sl_rail_util_pa_config.h>' '-DSL_CODE_COMPONENT_SE_MANAGER=se_manager' '-DSL_CODE_COMPONENT_CORE=core' '-DSL_RAIL_3_API=1' '-DSL_CODE_COMPONENT_SLEEPTIMER=sleeptimer' '-DSL_CODE_COMPONENT_SLI_CRYPTO=sli_crypto' '-DSLI_RADIOAES_REQUIRES_MASKING=1' '-DSL_CODE_COMPONENT_SLI_PROTOCOL_CRYPTO=sli_protocol_crypto' '-DSL_CODE_COMPONENT_PSEC_OSAL=psec_osal' -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\config" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\config\btconf" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\autogen" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\brd4184a" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\driver\hall" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\driver\imu" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\Device\SiliconLabs\EFR32BG22\Include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_assert" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_log" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_timer" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\common\util\app_timer\bm" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\protocol\bluetooth\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\common\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\protocol\bluetooth\bgcommon\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\protocol\bluetooth\bgstack\ll\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\board\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\bootloader" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\bootloader\api" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\bootloader\core\flash" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\button\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\clock_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\clock_manager\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\CMSIS\Core\Include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\configuration_over_swo\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\debug\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\device_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\device_init\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\dmadrv\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\dmadrv\inc\s2_signals" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\common\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emlib\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_aio" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_battery" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_device_information_override" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_hall" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_imu" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_light" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\gatt_service_rht" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\gpio\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\peripheral\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\i2cspm\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\icm20648\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\imu\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\in_place_ota_dfu" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\interrupt_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\interrupt_manager\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\interrupt_manager\inc\arm" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\iostream\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\driver\leddrv\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\crypto_ip\libcryptosoc\include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\crypto_ip\libcryptosoc\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_mbedtls_support\config" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_mbedtls_support\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\mbedtls\include" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\mbedtls\library" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\memory_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\memory_manager\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\memory_manager\profiler\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\mpu\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\mx25_flash_shutdown\inc\sl_mx25_flash_shutdown_usart" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\nvm3\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\emdrv\nvm3\config" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\power_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\power_supply" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\printf" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\util\third_party\printf\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_psa_driver\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\common" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\ble" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\ieee802154" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\wmbus" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\zwave" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\chip\efr32\efr32xg2x" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\protocol\sidewalk" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\pa-conversions" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\pa-conversions\efr32xg22" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\rail_util_power_manager_init" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\radio\rail_lib\plugin\rail_util_pti" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\se_manager\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\sensor_light" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\app\bluetooth\common\sensor_rht" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\si1133\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\si70xx\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\hardware\driver\si7210\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\sl_main\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\sl_main\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\sleeptimer\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sli_crypto\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sl_protocol_crypto\src" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\security\sl_component\sli_psec_osal\inc" -I"C:\Users\romer\SimplicityStudio\v5_workspace\base\simplicity_sdk_2025.6.0\platform\service\udelay\inc" -Os -Wall -Wextra -ffunction-sections -fdata-sections -mcmse -mfpu=fpv5-sp-d16 -mfloat-abi=hard -fno-builtin-printf -fno-builtin-sprintf -fno-lto --specs=nano.specs -c -fmessage-length=0 -MMD -MP -MF"tx_power.d" -MT"$@" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
 
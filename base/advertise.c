@@ -28,28 +28,42 @@
  *
  ******************************************************************************/
 
-#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
 #include "sl_bluetooth.h"
 #include "gatt_db.h"
-#include "app_timer.h"
 #include "app_assert.h"
+#include "sl_sleeptimer.h"
 #include "board.h"
+#include "energy_estimator.h"
 #include "advertise.h"
 
-typedef enum {
-  ADV_TYPE_IBEACON,
-  ADV_TYPE_SCAN_RESPONSE
-} adv_type_t;
-
 // -----------------------------------------------------------------------------
 // Configuration
 
-#define ADV_ALTERNATE_TIME_MS 1000
-#define ADV_TYPE_DEFAULT      ADV_TYPE_SCAN_RESPONSE
+// Advertising interval of the connectable set: 100 ms (milliseconds * 1.6)
+#define ADV_CONNECTABLE_INTERVAL    160
+// Advertising interval of the connectable set while connected: 1 s
+// (milliseconds * 1.6). Further centrals may take longer to connect.
+#define ADV_CONNECTED_INTERVAL      1600
+// Advertising interval of the iBeacon set: 1 s (milliseconds * 1.6). Scanners
+// ranging beacons need far fewer packets than a central connecting.
+#define ADV_IBEACON_INTERVAL        1600
 
 // -----------------------------------------------------------------------------
 // Private macros
 
+/** Maximum length of legacy advertising data. */
+#define ADVERTISE_LEGACY_DATA_LEN_MAX               31
+
+/** Length of the AD structure spanning from its type field to the last field
+ *  of its payload, computed from the layout of the advertising data type. */
+#define ADVERTISE_AD_LENGTH(data_type, type_field, last_field) \
+  (offsetof(data_type, last_field)                              \
+   + sizeof(((data_type *)0)->last_field)                       \
+   - offsetof(data_type, type_field))
+
 // -------------------------------
 // Advertising flags (common)
 
@@ -75,7 +89,7 @@ typedef enum {
 #define ADVERTISE_DEVICE_NAME_LEN_MAX               20
 #define ADVERTISE_DEVICE_NAME_DEFAULT_PREFIX        "Thunderboard "
 #define ADVERTISE_DEVICE_NAME_DEFAULT_SUFFIX        "#00000"
-#define ADVERTISE_DEVICE_NAME_FORMAT_STRING         "#%05d"
+#define ADVERTISE_DEVICE_NAME_SUFFIX_DIGITS         5
 
 // -------------------------------
 // iBeacon
@@ -88,9 +102,6 @@ typedef enum {
 /** The Beacon's measured RSSI at 1 meter distance in dBm. */
 #define ADVERTISE_IBEACON_RSSI               0xC3
 
-/** Length of Manufacturer specific data field. */
-#define ADVERTISE_IBEACON_MAN_SPEC_DATA_LEN  26
-
 /** Universally Unique ID used in the Beacon.
  *  128-bit long ID. */
 #define ADVERTISE_IBEACON_UUID                      \
@@ -123,7 +134,9 @@ typedef struct {
     .flags_type            = ADVERTISE_FLAGS_TYPE,                        \
     .flags                 = ADVERTISE_FLAGS_LE_GENERAL_DISCOVERABLE      \
                              | ADVERTISE_FLAGS_BR_EDR_NOT_SUPPORTED,      \
-    .mandatory_data_length = ADVERTISE_IBEACON_MAN_SPEC_DATA_LEN,         \
+    .mandatory_data_length = ADVERTISE_AD_LENGTH(advertise_ibeacon_t,     \
+                                                 mandatory_data_type,     \
+                                                 rssi),                   \
     .mandatory_data_type   = ADVERTISE_MANDATORY_DATA_TYPE_MANUFACTURER,  \
     .company_id            = UINT16_TO_BYTES(ADVERTISE_IBEACON_PREAMBLE), \
     .beacon_type           = UINT16_TO_BYTES(ADVERTISE_IBEACON_TYPE),     \
@@ -155,7 +168,9 @@ typedef struct {
     .flags_type            = ADVERTISE_FLAGS_TYPE,                       \
     .flags                 = ADVERTISE_FLAGS_LE_GENERAL_DISCOVERABLE     \
                              | ADVERTISE_FLAGS_BR_EDR_NOT_SUPPORTED,     \
-    .mandatory_data_length = ADVERTISE_MANDATORY_DATA_LENGTH,            \
+    .mandatory_data_length = ADVERTISE_AD_LENGTH(advertise_scan_response_t, \
+                                                 mandatory_data_type,       \
+                                                 firmware_id),              \
     .mandatory_data_type   = ADVERTISE_MANDATORY_DATA_TYPE_MANUFACTURER, \
     .company_id            = UINT16_TO_BYTES(ADVERTISE_COMPANY_ID),      \
     .firmware_id           = UINT16_TO_BYTES(ADVERTISE_FIRMWARE_ID),     \
@@ -165,55 +180,56 @@ typedef struct {
                              ADVERTISE_DEVICE_NAME_DEFAULT_SUFFIX        \
   }
 
+// Compile-time checks of the advertising data layout
+_Static_assert(sizeof(advertise_ibeacon_t) <= ADVERTISE_LEGACY_DATA_LEN_MAX,
+               "iBeacon data does not fit in legacy advertising data");
+_Static_assert(sizeof(advertise_scan_response_t) <= ADVERTISE_LEGACY_DATA_LEN_MAX,
+               "Scan response data does not fit in legacy advertising data");
+_Static_assert(ADVERTISE_AD_LENGTH(advertise_scan_response_t, mandatory_data_type, firmware_id)
+               == ADVERTISE_MANDATORY_DATA_LENGTH,
+               "Unexpected manufacturer data length");
+_Static_assert(sizeof(ADVERTISE_DEVICE_NAME_DEFAULT_SUFFIX) - 1
+               == ADVERTISE_DEVICE_NAME_SUFFIX_DIGITS + 1,
+               "Device name suffix does not match the number of digits");
+
 // -----------------------------------------------------------------------------
 // Private variables
 
-// Advertising data structures
+// Advertising data structures, built once in advertise_init
 static advertise_ibeacon_t  adv_ibeacon = ADVERTISE_IBEACON_DATA_DEFAULT;
 static advertise_scan_response_t adv_scan_response = ADVERTISE_SCAN_RESPONSE_DEFAULT;
+static size_t adv_scan_response_length = sizeof(advertise_scan_response_t);
 
-// Advertising timer
-static app_timer_t adv_timer;
-
-// Advertising set handle allocated by Bluetooth stack
+// Advertising set handles allocated by Bluetooth stack
 static uint8_t adv_set_handle = 0xff;
+static uint8_t adv_ibeacon_set_handle = 0xff;
 
 // -----------------------------------------------------------------------------
 // Private function declarations
 
-static void adv_set_data(adv_type_t type);
-static void adv_timer_cb(app_timer_t *timer, void *data);
+static void adv_set_name_suffix(char *name, size_t name_length, uint32_t unique_id);
 
 // -----------------------------------------------------------------------------
 // Private function definitions
 
-static void adv_set_data(adv_type_t type)
+static void adv_set_name_suffix(char *name, size_t name_length, uint32_t unique_id)
 {
-  sl_status_t sc;
-  uint8_t *data = (type == ADV_TYPE_IBEACON)
-                  ? (uint8_t*)(&adv_ibeacon)
-                  : (uint8_t*)(&adv_scan_response);
-  size_t length = (type == ADV_TYPE_IBEACON)
-                  ? sizeof(adv_ibeacon)
-                  : sizeof(adv_scan_response);
-
-  sc = sl_bt_legacy_advertiser_set_data(adv_set_handle, 0, length, data);
-  app_assert_status(sc);
-}
+  const size_t suffix_length = sizeof(ADVERTISE_DEVICE_NAME_DEFAULT_SUFFIX) - 1;
+  uint32_t number = unique_id & 0xFFFF;
+
+  // The device name in the GATT database ends with the default suffix.
+  app_assert((name_length >= suffix_length)
+             && (memcmp(&name[name_length - suffix_length],
+                        ADVERTISE_DEVICE_NAME_DEFAULT_SUFFIX,
+                        suffix_length) == 0),
+             "Device name substring cannot be found: %s" APP_LOG_NL,
+             name);
 
-static void adv_timer_cb(app_timer_t *timer, void *data)
-{
-  (void)timer;
-  (void)data;
-  // Initial advertising type
-  static adv_type_t advType = ADV_TYPE_DEFAULT;
-  // Swap advertising message
-  advType = (advType == ADV_TYPE_IBEACON)
-            ? ADV_TYPE_SCAN_RESPONSE
-            : ADV_TYPE_IBEACON;
-  adv_set_data(advType);
-  // Toggle advertising LED state
-  adv_led_toggle();
+  // Overwrite the digits of the suffix with the decimal number.
+  for (size_t i = name_length - 1; i > name_length - suffix_length; i--) {
+    name[i] = (char)('0' + (number % 10));
+    number /= 10;
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -239,46 +255,65 @@ void advertise_init(uint32_t unique_id)
   adv_ibeacon.minor[0] = (uint8_t)(unique_id >> 8);
   adv_ibeacon.major[1] = (uint8_t)(unique_id >> 16);
 
-  // Search for device name suffix
-  char *suffix;
-  suffix = strstr((char *)local_name, ADVERTISE_DEVICE_NAME_DEFAULT_SUFFIX);
-  app_assert(suffix != NULL,
-             "Device name substring cannot be found: %s" APP_LOG_NL,
-             (char *)local_name);
-
   // Update Scan Response data
-  (void)snprintf(suffix,
-                 strlen(ADVERTISE_DEVICE_NAME_DEFAULT_SUFFIX) + 1,
-                 ADVERTISE_DEVICE_NAME_FORMAT_STRING,
-                 (int)(unique_id & 0xFFFF));
+  local_name[local_name_length] = '\0';
+  adv_set_name_suffix((char *)local_name, local_name_length, unique_id);
   (void)memcpy(adv_scan_response.local_name,
                local_name,
-               local_name_length + 1);
+               local_name_length);
   adv_scan_response.local_name_length = local_name_length + 1;
+  adv_scan_response_length = offsetof(advertise_scan_response_t, local_name)
+                             + local_name_length;
 
-  // Create an advertising set
+  // Create the connectable advertising set, its timing is set on start
   sc = sl_bt_advertiser_create_set(&adv_set_handle);
   app_assert_status(sc);
 
-  // Set advertising interval to 100ms
+  // Create the iBeacon advertising set running next to the connectable one
+  sc = sl_bt_advertiser_create_set(&adv_ibeacon_set_handle);
+  app_assert_status(sc);
+
   sc = sl_bt_advertiser_set_timing(
-    adv_set_handle, // advertising set handle
-    160, // min. adv. interval (milliseconds * 1.6)
-    160, // max. adv. interval (milliseconds * 1.6)
-    0,   // adv. duration
-    0);  // max. num. adv. events
+    adv_ibeacon_set_handle, // advertising set handle
+    ADV_IBEACON_INTERVAL,   // min. adv. interval (milliseconds * 1.6)
+    ADV_IBEACON_INTERVAL,   // max. adv. interval (milliseconds * 1.6)
+    0,                      // adv. duration
+    0);                     // max. num. adv. events
+  app_assert_status(sc);
+
+  // The payloads do not change, load them into the stack once.
+  sc = sl_bt_legacy_advertiser_set_data(adv_set_handle,
+                                        sl_bt_advertiser_advertising_data_packet,
+                                        adv_scan_response_length,
+                                        (uint8_t *)&adv_scan_response);
+  app_assert_status(sc);
+  sc = sl_bt_legacy_advertiser_set_data(adv_ibeacon_set_handle,
+                                        sl_bt_advertiser_advertising_data_packet,
+                                        sizeof(adv_ibeacon),
+                                        (uint8_t *)&adv_ibeacon);
   app_assert_status(sc);
   // Start advertising
-  advertise_start();
-  app_log_info("Started advertising as '%s'" APP_LOG_NL, (char *)local_name);
+  advertise_start(false);
+  // Boot time to the first advertisement, counted from the sleeptimer start
+  // in sl_main_init(). It used to include the power supply probe, whose
+  // completion app.c logs on the same time base.
+  app_log_info("Started advertising as '%s' %lu ms after start-up" APP_LOG_NL,
+               (char *)local_name,
+               (unsigned long)sl_sleeptimer_tick_to_ms(sl_sleeptimer_get_tick_count()));
 }
 
-void advertise_start(void)
+void advertise_start(bool connected)
 {
   sl_status_t sc;
+  uint16_t interval = connected ? ADV_CONNECTED_INTERVAL : ADV_CONNECTABLE_INTERVAL;
 
-  // Set initial advertising data type
-  adv_set_data(ADV_TYPE_DEFAULT);
+  sc = sl_bt_advertiser_set_timing(
+    adv_set_handle, // advertising set handle
+    interval,       // min. adv. interval (milliseconds * 1.6)
+    interval,       // max. adv. interval (milliseconds * 1.6)
+    0,              // adv. duration
+    0);             // max. num. adv. events
+  app_assert_status(sc);
 
   // Turn on advertising LED
   adv_led_turn_on();
@@ -288,25 +323,31 @@ void advertise_start(void)
                                      sl_bt_legacy_advertiser_connectable);
   app_assert_status(sc);
 
-  // Start timer to alternate advertising data
-  sc = app_timer_start(&adv_timer,
-                       ADV_ALTERNATE_TIME_MS,
-                       adv_timer_cb,
-                       NULL,
-                       true);
+  // Start the iBeacon
+  sc = sl_bt_legacy_advertiser_start(adv_ibeacon_set_handle,
+                                     sl_bt_legacy_advertiser_non_connectable);
   app_assert_status(sc);
+
+#if ENERGY_ESTIMATOR_ENABLE
+  energy_estimator_set_advertiser(adv_set_handle, true, interval);
+  energy_estimator_set_advertiser(adv_ibeacon_set_handle, false, ADV_IBEACON_INTERVAL);
+#endif // ENERGY_ESTIMATOR_ENABLE
 }
 
 void advertise_stop(void)
 {
   sl_status_t sc;
-  // Stop advertising timer
-  sc = app_timer_stop(&adv_timer);
-  app_assert_status(sc);
   // Stop advertising
   sc = sl_bt_advertiser_stop(adv_set_handle);
   app_assert_status(sc);
+  sc = sl_bt_advertiser_stop(adv_ibeacon_set_handle);
+  app_assert_status(sc);
 
   // Turn off advertising LED
   adv_led_turn_off();
+
+#if ENERGY_ESTIMATOR_ENABLE
+  energy_estimator_set_advertiser(adv_set_handle, true, 0);
+  energy_estimator_set_advertiser(adv_ibeacon_set_handle, false, 0);
+#endif // ENERGY_ESTIMATOR_ENABLE
 }
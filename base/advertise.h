@@ -31,10 +31,13 @@
 #ifndef ADVERTISE_H
 #define ADVERTISE_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 void advertise_init(uint32_t unique_id);
-void advertise_start(void);
+// Start both advertising sets. While connected, the connectable set advertises
+// at a slower interval.
+void advertise_start(bool connected);
 void advertise_stop(void);
 
 #endif // ADVERTISE_H
@@ -38,10 +38,26 @@
 #include "sl_main_init.h"
 #include "sl_bluetooth.h"
 #include "app_timer.h"
+#include "sl_sleeptimer.h"
 #include "advertise.h"
+#include "bt_dispatch.h"
+#include "bt_subscriptions.h"
+#include "clock_cal.h"
+#include "energy_estimator.h"
 #include "sl_power_supply.h"
+#include "nvm3.h"
+#include "nvm3_default_config.h"
+#include "sl_power_manager_debug.h"
+#include "sl_debug_swo.h"
+#include "sl_debug_swo_config.h"
+#include "sli_protocol_crypto.h"
+#include "swo_stream.h"
+#include "sl_simple_led_instances.h"
 #include "board.h"
 #include "sl_component_catalog.h"
+#ifdef SL_CATALOG_BLUETOOTH_FEATURE_USER_POWER_CONTROL_PRESENT
+#include "tx_power.h"
+#endif // SL_CATALOG_BLUETOOTH_FEATURE_USER_POWER_CONTROL_PRESENT
 #ifdef SL_CATALOG_GATT_SERVICE_AIO_PRESENT
 #include "sl_gatt_service_aio.h"
 #endif // SL_CATALOG_GATT_SERVICE_AIO_PRESENT
@@ -94,26 +110,59 @@
 // Private variables
 // Timer
 static app_timer_t shutdown_timer;
+// Number of open connections
+static uint8_t connection_count = 0;
+// Sensors initialized
+static bool sensors_active = false;
 
 // -----------------------------------------------------------------------------
 // Private function declarations
 static void shutdown_start_timer(void);
 static void shutdown_stop_timer(void);
 static void shutdown(app_timer_t *timer, void *data);
+static void power_supply_probe_done(uint8_t type);
+#if NVM3_TELEMETRY
+static void nvm3_telemetry_log(void);
+#endif
 static void sensor_init(void);
 static void sensor_deinit(void);
+static void sensor_update(void);
+static void advertising_update(void);
+#if ENERGY_ESTIMATOR_ENABLE
+static void led_load_update(void);
+#endif // ENERGY_ESTIMATOR_ENABLE
 
 // -----------------------------------------------------------------------------
 // Public function definitions
+void app_init_early(void)
+{
+  clock_cal_init_early();
+}
+
 void app_init(void)
 {
+  sl_status_t sc;
+#if SL_DEBUG_SWO_BUFFER_SIZE > 0
+  // Log to the SWO through its buffer, drained in app_process_action().
+  sc = app_log_iostream_set(swo_stream_handle);
+  app_assert_status(sc);
+#endif
   app_log_info("Silicon Labs Thunderboard / DevKit demo" APP_LOG_NL);
-  sl_power_supply_probe();
-  shutdown_start_timer();
+  sc = sl_power_supply_probe_start(power_supply_probe_done);
+  app_assert_status(sc);
+  clock_cal_init();
+#if ENERGY_ESTIMATOR_ENABLE
+  energy_estimator_init();
+#endif // ENERGY_ESTIMATOR_ENABLE
 }
 
 void app_process_action(void)
 {
+  sl_power_supply_step();
+#if SL_DEBUG_SWO_BUFFER_SIZE > 0
+  sl_debug_swo_process_action();
+#endif
+
   #ifdef SL_CATALOG_GATT_SERVICE_SOUND_PRESENT
   sensor_sound_step();
   #endif // SL_CATALOG_GATT_SERVICE_SOUND_PRESENT
@@ -125,6 +174,15 @@ void app_process_action(void)
   /////////////////////////////////////////////////////////////////////////////
 }
 
+#if SL_DEBUG_SWO_BUFFER_SIZE > 0
+// Power manager hook, called with interrupts disabled
+bool app_is_ok_to_sleep(void)
+{
+  // The SWO stops in EM2, let the buffered writes drain first.
+  return sl_debug_swo_is_ok_to_sleep();
+}
+#endif
+
 // -----------------------------------------------------------------------------
 // Bluetooth event handler
 void sl_bt_on_event(sl_bt_msg_t *evt)
@@ -134,6 +192,13 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
   uint8_t address_type;
   uint32_t unique_id;
 
+#ifdef SL_CATALOG_BLUETOOTH_FEATURE_USER_POWER_CONTROL_PRESENT
+  tx_power_on_event(evt);
+#endif // SL_CATALOG_BLUETOOTH_FEATURE_USER_POWER_CONTROL_PRESENT
+#if ENERGY_ESTIMATOR_ENABLE
+  energy_estimator_on_event(evt);
+#endif // ENERGY_ESTIMATOR_ENABLE
+
   switch (SL_BT_MSG_ID(evt->header)) {
     // -------------------------------
     case sl_bt_evt_system_boot_id:
@@ -143,6 +208,14 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
                    evt->data.evt_system_boot.minor,
                    evt->data.evt_system_boot.patch,
                    evt->data.evt_system_boot.hash);
+      // Catch a regenerated autogen/sl_bluetooth.c without the hooks of the
+      // subscription table and the event dispatch table.
+      app_assert(bt_subscription_is_booted(),
+                 "bt_subscription_on_event() missing from sl_bt_process_event()" APP_LOG_NL);
+#if SL_BT_CONFIG_EVENT_DISPATCH_TABLE
+      app_assert(bt_dispatch_is_booted(),
+                 "bt_dispatch_process_event() missing from sl_bt_process_event()" APP_LOG_NL);
+#endif // SL_BT_CONFIG_EVENT_DISPATCH_TABLE
       sc = sl_bt_gap_get_identity_address(&address, &address_type);
       app_assert_status(sc);
       app_log_info("Bluetooth %s address: %02X:%02X:%02X:%02X:%02X:%02X" APP_LOG_NL,
@@ -160,23 +233,55 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
     // -------------------------------
     case sl_bt_evt_connection_opened_id:
       app_log_info("Connection opened" APP_LOG_NL);
-      advertise_stop();
+#if ENERGY_ESTIMATOR_ENABLE
+      if (connection_count == 0) {
+        energy_estimator_log_and_reset("advertising");
+      }
+#endif // ENERGY_ESTIMATOR_ENABLE
+      connection_count++;
+      advertising_update();
       shutdown_stop_timer();
-      sensor_init();
+      sensor_update();
       break;
 
     // -------------------------------
     case sl_bt_evt_connection_closed_id:
       app_log_info("Connection closed" APP_LOG_NL);
-      shutdown_start_timer();
-      sensor_deinit();
-      advertise_start();
+      if (connection_count > 0) {
+        connection_count--;
+      }
+      if (connection_count == 0) {
+#if ENERGY_ESTIMATOR_ENABLE
+        energy_estimator_log_and_reset("connected");
+#endif // ENERGY_ESTIMATOR_ENABLE
+#if NVM3_TELEMETRY
+        nvm3_telemetry_log();
+#endif
+#if SL_POWER_MANAGER_DEBUG && SL_POWER_MANAGER_DEBUG_STATISTICS
+        sl_power_manager_debug_print_statistics();
+#endif
+        shutdown_start_timer();
+      }
+      sensor_update();
+      advertising_update();
+      break;
+
+    // -------------------------------
+    case sl_bt_evt_sm_bonded_id:
+      // The IRK of the new bond may have replaced an old one in the resolving
+      // list without changing its key mask, drop the cached RPA resolutions.
+      sli_process_ble_rpa_cache_invalidate();
       break;
 
     // -------------------------------
     default:
       break;
   }
+
+#if ENERGY_ESTIMATOR_ENABLE
+  // Advertising and AIO writes turn the LEDs on and off
+  led_load_update();
+#endif // ENERGY_ESTIMATOR_ENABLE
 }
 
 // -----------------------------------------------------------------------------
@@ -197,9 +302,37 @@ static void shutdown(app_timer_t *timer, void *data)
   (void)data;
 
   advertise_stop();
+#if ENERGY_ESTIMATOR_ENABLE
+  // Not called from the Bluetooth event handler, update the LEDs here.
+  led_load_update();
+  energy_estimator_log_and_reset("advertising");
+#endif // ENERGY_ESTIMATOR_ENABLE
+#if NVM3_TELEMETRY
+  // The statistics live in RAM and do not survive EM4.
+  nvm3_telemetry_log();
+#endif
+#if SL_POWER_MANAGER_DEBUG && SL_POWER_MANAGER_DEBUG_STATISTICS
+  sl_power_manager_debug_print_statistics();
+#endif
   EMU_EnterEM4();
 }
 
+static void power_supply_probe_done(uint8_t type)
+{
+  // The probe starts in app_init(). When it blocked there, the stack booted
+  // and advertised only after this time, compare with the start-up time
+  // logged by advertise_init().
+  app_log_info("Power supply type %u probed %lu ms after start-up" APP_LOG_NL,
+               type,
+               (unsigned long)sl_sleeptimer_tick_to_ms(sl_sleeptimer_get_tick_count()));
+  // The shutdown timer depends on the supply type, arm it once it is known.
+  if (connection_count == 0) {
+    shutdown_start_timer();
+  }
+  // Sensors were held off while the probe used the Si7021.
+  sensor_update();
+}
+
 static void shutdown_start_timer(void)
 {
   sl_status_t sc;
@@ -216,11 +349,45 @@ static void shutdown_stop_timer(void)
   app_assert_status(sc);
 }
 
+#if NVM3_TELEMETRY
+// -----------------------------------------------------------------------------
+// NVM3 telemetry dump over VCOM
+static void nvm3_telemetry_log(void)
+{
+  nvm3_Telemetry_t t;
+  uint32_t erase_cnt[NVM3_DEFAULT_NVM_SIZE / FLASH_PAGE_SIZE];
+  size_t page_cnt = sizeof(erase_cnt) / sizeof(erase_cnt[0]);
+
+  if (nvm3_getTelemetry(nvm3_defaultHandle, &t) != SL_STATUS_OK) {
+    return;
+  }
+  app_log_info("NVM3 repack: %lu user, %lu forced, %lu erased, %lu B copied (max %lu), %lu ticks (max %lu)" APP_LOG_NL,
+               t.userRepackCount, t.forcedRepackCount, t.pageEraseCount,
+               t.repackBytesCopied, t.repackMaxBytesCopied,
+               t.repackTicks, t.repackMaxTicks);
+  app_log_info("NVM3 writes: user %lu (%lu B), bluetooth %lu (%lu B), psa its %lu (%lu B), other %lu (%lu B)" APP_LOG_NL,
+               t.writeCount[NVM3_TELEMETRY_KEY_RANGE_USER], t.writeBytes[NVM3_TELEMETRY_KEY_RANGE_USER],
+               t.writeCount[NVM3_TELEMETRY_KEY_RANGE_BLUETOOTH], t.writeBytes[NVM3_TELEMETRY_KEY_RANGE_BLUETOOTH],
+               t.writeCount[NVM3_TELEMETRY_KEY_RANGE_PSA_ITS], t.writeBytes[NVM3_TELEMETRY_KEY_RANGE_PSA_ITS],
+               t.writeCount[NVM3_TELEMETRY_KEY_RANGE_OTHER], t.writeBytes[NVM3_TELEMETRY_KEY_RANGE_OTHER]);
+  if (nvm3_getPageEraseCounts(nvm3_defaultHandle, erase_cnt, &page_cnt) == SL_STATUS_OK) {
+    app_log_info("NVM3 page erase counts:");
+    for (size_t i = 0; i < page_cnt; i++) {
+      app_log_append(" %lu", erase_cnt[i]);
+    }
+    app_log_nl();
+  }
+}
+#endif // NVM3_TELEMETRY
+
 // -----------------------------------------------------------------------------
 // Sensor batch init/deinit
 static void sensor_init(void)
 {
   sl_status_t sc;
+#if ENERGY_ESTIMATOR_ENABLE
+  energy_estimator_set_load(ENERGY_ESTIMATOR_LOAD_SENSOR_SUPPLY, 1);
+#endif // ENERGY_ESTIMATOR_ENABLE
 #ifdef SL_CATALOG_GATT_SERVICE_HALL_PRESENT
   sc = sensor_hall_init();
   if (sc != SL_STATUS_OK) {
@@ -264,6 +431,9 @@ static void sensor_init(void)
 
 static void sensor_deinit(void)
 {
+#if ENERGY_ESTIMATOR_ENABLE
+  energy_estimator_set_load(ENERGY_ESTIMATOR_LOAD_SENSOR_SUPPLY, 0);
+#endif // ENERGY_ESTIMATOR_ENABLE
 #ifdef SL_CATALOG_GATT_SERVICE_HALL_PRESENT
   sensor_hall_deinit();
 #endif // SL_CATALOG_GATT_SERVICE_HALL_PRESENT
@@ -291,6 +461,48 @@ static void sensor_deinit(void)
 #endif // SL_CATALOG_GATT_SERVICE_SOUND_PRESENT
 }
 
+// Initialize the sensors while any connection is open, and keep them running
+// until the last one closes. The power supply probe drives the Si7021 and its
+// supply enable, so wait until it is done.
+static void sensor_update(void)
+{
+  bool wanted = (connection_count > 0) && !sl_power_supply_is_probe_in_progress();
+
+  if (wanted && !sensors_active) {
+    sensor_init();
+  } else if (!wanted && sensors_active) {
+    sensor_deinit();
+  }
+  sensors_active = wanted;
+}
+
+// The stack stops the connectable set when a central connects. Restart both
+// sets while another central can still connect, slower while one is connected,
+// and stop them at the limit.
+static void advertising_update(void)
+{
+  advertise_stop();
+  if (connection_count < SL_BT_CONFIG_MAX_CONNECTIONS) {
+    advertise_start(connection_count > 0);
+  }
+}
+
+#if ENERGY_ESTIMATOR_ENABLE
+// The advertising indication and the AIO outputs share the LEDs. Trace the
+// LEDs that are on, whoever turned them on, so neither overwrites the other.
+static void led_load_update(void)
+{
+  uint8_t count = 0;
+
+  for (uint8_t i = 0; i < SL_SIMPLE_LED_COUNT; i++) {
+    if (sl_led_get_state(SL_SIMPLE_LED_INSTANCE(i)) == SL_LED_CURRENT_STATE_ON) {
+      count++;
+    }
+  }
+  energy_estimator_set_load(ENERGY_ESTIMATOR_LOAD_LED, count);
+}
+#endif // ENERGY_ESTIMATOR_ENABLE
+
 // -----------------------------------------------------------------------------
 // Connect GATT services with sensors by overriding weak functions
 
@@ -299,6 +511,10 @@ uint8_t sl_gatt_service_battery_get_level(void)
 {
   uint8_t bat_level;
   bat_level = sl_power_supply_get_battery_level();
+  if (SL_POWER_SUPPLY_BATTERY_LEVEL_UNKNOWN == bat_level) {
+    app_log_info("Battery level unknown" APP_LOG_NL);
+    return SL_GATT_SERVICE_BATTERY_LEVEL_UNKNOWN;
+  }
   app_log_info("Battery level = %d %%" APP_LOG_NL, bat_level);
   return bat_level;
 }
@@ -329,7 +545,13 @@ sl_status_t sl_gatt_service_hall_get(float *field_strength, bool *alert, bool *t
 sl_status_t sl_gatt_service_light_get(float *lux, float *uvi)
 {
   sl_status_t sc;
+#if ENERGY_ESTIMATOR_ENABLE
+  energy_estimator_set_load(ENERGY_ESTIMATOR_LOAD_SI1133, 1);
+#endif // ENERGY_ESTIMATOR_ENABLE
   sc = sl_sensor_light_get(lux, uvi);
+#if ENERGY_ESTIMATOR_ENABLE
+  energy_estimator_set_load(ENERGY_ESTIMATOR_LOAD_SI1133, 0);
+#endif // ENERGY_ESTIMATOR_ENABLE
   if (SL_STATUS_OK == sc) {
     app_log_info("Ambient light = %f lux" APP_LOG_NL, (double)*lux);
     app_log_info("UV Index = %u" APP_LOG_NL, (unsigned int)*uvi);
@@ -362,7 +584,13 @@ sl_status_t sl_gatt_service_lux_get(float *lux)
 sl_status_t sl_gatt_service_rht_get(uint32_t *rh, int32_t *t)
 {
   sl_status_t sc;
+#if ENERGY_ESTIMATOR_ENABLE
+  energy_estimator_set_load(ENERGY_ESTIMATOR_LOAD_SI70XX, 1);
+#endif // ENERGY_ESTIMATOR_ENABLE
   sc = sl_sensor_rht_get(rh, t);
+#if ENERGY_ESTIMATOR_ENABLE
+  energy_estimator_set_load(ENERGY_ESTIMATOR_LOAD_SI70XX, 0);
+#endif // ENERGY_ESTIMATOR_ENABLE
   if (SL_STATUS_OK == sc) {
     app_log_info("Humidity = %3.2f %%RH" APP_LOG_NL, (double)*rh / 1000.0);
     app_log_info("Temperature = %3.2f C" APP_LOG_NL, (double)*t / 1000.0);
@@ -41,6 +41,10 @@
 #include "sl_gatt_service_imu.h"
 #include "sl_gatt_service_light.h"
 #include "sl_gatt_service_rht.h"
+#include "bt_subscriptions.h"
+#if SL_BT_CONFIG_EVENT_DISPATCH_TABLE
+#include "bt_dispatch.h"
+#endif
 
 void sl_bt_init(void)
 {
@@ -57,8 +61,17 @@ SL_WEAK void sl_bt_on_event(sl_bt_msg_t* evt)
   (void)(evt);
 }
 
+#if SL_BT_CONFIG_EVENT_DISPATCH_TABLE
 void sl_bt_process_event(sl_bt_msg_t *evt)
 {
+  bt_subscription_on_event(evt);
+  bt_dispatch_process_event(evt);
+  sl_bt_on_event(evt);
+}
+#else // SL_BT_CONFIG_EVENT_DISPATCH_TABLE
+void sl_bt_process_event(sl_bt_msg_t *evt)
+{
+  bt_subscription_on_event(evt);
   sl_bt_in_place_ota_dfu_on_event(evt);
   sl_gatt_service_aio_on_event(evt);
   sl_gatt_service_battery_on_event(evt);
@@ -69,6 +82,7 @@ void sl_bt_process_event(sl_bt_msg_t *evt)
   sl_gatt_service_rht_on_event(evt);
   sl_bt_on_event(evt);
 }
+#endif // SL_BT_CONFIG_EVENT_DISPATCH_TABLE
 
 #if !defined(SL_CATALOG_KERNEL_PRESENT)
 // When running in an RTOS, the stack events are processed in a dedicated
@@ -18,6 +18,7 @@
 #define SL_CATALOG_BLUETOOTH_FEATURE_LEGACY_ADVERTISER_PRESENT
 #define SL_CATALOG_BLUETOOTH_FEATURE_SM_PRESENT
 #define SL_CATALOG_BLUETOOTH_FEATURE_SYSTEM_PRESENT
+#define SL_CATALOG_BLUETOOTH_FEATURE_USER_POWER_CONTROL_PRESENT
 #define SL_CATALOG_BLUETOOTH_HOST_ADAPTATION_PRESENT
 #define SL_CATALOG_BLUETOOTH_PRESENT
 #define SL_CATALOG_GECKO_BOOTLOADER_INTERFACE_PRESENT
@@ -0,0 +1,220 @@
+/***************************************************************************//**
+ * @file
+ * @brief Thunderboard Bluetooth event dispatch
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "sl_bluetooth.h"
+#include "gatt_db.h"
+#include "app_assert.h"
+#include "app_log.h"
+#include "sl_bt_in_place_ota_dfu.h"
+#include "sl_gatt_service_aio.h"
+#include "sl_gatt_service_battery.h"
+#include "sl_gatt_service_device_information_override.h"
+#include "sl_gatt_service_hall.h"
+#include "sl_gatt_service_imu.h"
+#include "sl_gatt_service_light.h"
+#include "sl_gatt_service_rht.h"
+#include "bt_dispatch.h"
+
+#if SL_BT_CONFIG_EVENT_DISPATCH_TABLE
+
+// -----------------------------------------------------------------------------
+// Configuration
+
+// Size of the attribute owner table: the highest characteristic handle in
+// gatt_db.h plus one. An owner entry past it fails to compile, a characteristic
+// past it in the GATT database fails the boot check.
+#define BT_DISPATCH_ATTRIBUTE_COUNT     (gattdb_ota_control + 1)
+
+// GATT database attribute datatypes, see gatt_db.c. The SDK has no names for
+// them, tools/bt_dispatch checks them against the GATT configuration.
+#define BT_DISPATCH_DATATYPE_CHARACTERISTIC  0x05
+#define BT_DISPATCH_DATATYPE_USER            0x07
+// Characteristic properties generating characteristic status events
+#define BT_DISPATCH_PROPERTIES_STATUS        (SL_BT_GATTDB_CHARACTERISTIC_NOTIFY \
+                                              | SL_BT_GATTDB_CHARACTERISTIC_INDICATE)
+
+// -----------------------------------------------------------------------------
+// Private types
+
+typedef void (*bt_dispatch_handler_t)(sl_bt_msg_t *evt);
+
+// Components owning user type or notified characteristics
+typedef enum {
+  BT_DISPATCH_OWNER_NONE = 0,
+  BT_DISPATCH_OWNER_STACK,
+  BT_DISPATCH_OWNER_OTA_DFU,
+  BT_DISPATCH_OWNER_AIO,
+  BT_DISPATCH_OWNER_BATTERY,
+  BT_DISPATCH_OWNER_HALL,
+  BT_DISPATCH_OWNER_IMU,
+  BT_DISPATCH_OWNER_LIGHT,
+  BT_DISPATCH_OWNER_RHT,
+  BT_DISPATCH_OWNER_COUNT
+} bt_dispatch_owner_t;
+
+_Static_assert(BT_DISPATCH_OWNER_COUNT <= UINT8_MAX,
+               "Owners must fit the attribute owner table");
+_Static_assert(BT_DISPATCH_ATTRIBUTE_COUNT > gattdb_es_humidity,
+               "Owner table must cover every owned characteristic");
+
+// -----------------------------------------------------------------------------
+// Private variables
+
+// Every component handler in the order of sl_bt_process_event(). Events without
+// a characteristic are rare and are passed to all of them, so a component
+// handling another event needs no change here.
+static const bt_dispatch_handler_t component_handlers[] = {
+  sl_bt_in_place_ota_dfu_on_event,
+  sl_gatt_service_aio_on_event,
+  sl_gatt_service_battery_on_event,
+  sl_gatt_service_device_information_override_on_event,
+  sl_gatt_service_hall_on_event,
+  sl_gatt_service_imu_on_event,
+  sl_gatt_service_light_on_event,
+  sl_gatt_service_rht_on_event,
+};
+
+// Component handlers of owned characteristics. The stack handles the Service
+// Changed characteristic itself.
+static const bt_dispatch_handler_t owner_handlers[BT_DISPATCH_OWNER_COUNT] = {
+  [BT_DISPATCH_OWNER_NONE]    = NULL,
+  [BT_DISPATCH_OWNER_STACK]   = NULL,
+  [BT_DISPATCH_OWNER_OTA_DFU] = sl_bt_in_place_ota_dfu_on_event,
+  [BT_DISPATCH_OWNER_AIO]     = sl_gatt_service_aio_on_event,
+  [BT_DISPATCH_OWNER_BATTERY] = sl_gatt_service_battery_on_event,
+  [BT_DISPATCH_OWNER_HALL]    = sl_gatt_service_hall_on_event,
+  [BT_DISPATCH_OWNER_IMU]     = sl_gatt_service_imu_on_event,
+  [BT_DISPATCH_OWNER_LIGHT]   = sl_gatt_service_light_on_event,
+  [BT_DISPATCH_OWNER_RHT]     = sl_gatt_service_rht_on_event,
+};
+
+// Owner of the characteristic, by attribute handle. tools/bt_dispatch checks
+// it against the service of each component in config/btconf.
+static const uint8_t attribute_owner[BT_DISPATCH_ATTRIBUTE_COUNT] = {
+  [gattdb_service_changed_char]  = BT_DISPATCH_OWNER_STACK,
+  [gattdb_ota_control]           = BT_DISPATCH_OWNER_OTA_DFU,
+  [gattdb_aio_digital_in]        = BT_DISPATCH_OWNER_AIO,
+  [gattdb_aio_digital_out]       = BT_DISPATCH_OWNER_AIO,
+  [gattdb_batt_measurement]      = BT_DISPATCH_OWNER_BATTERY,
+  [gattdb_power_source_type]     = BT_DISPATCH_OWNER_BATTERY,
+  [gattdb_hall_state]            = BT_DISPATCH_OWNER_HALL,
+  [gattdb_hall_field_strength]   = BT_DISPATCH_OWNER_HALL,
+  [gattdb_hall_control_point]    = BT_DISPATCH_OWNER_HALL,
+  [gattdb_imu_acceleration]      = BT_DISPATCH_OWNER_IMU,
+  [gattdb_imu_orientation]       = BT_DISPATCH_OWNER_IMU,
+  [gattdb_imu_control_point]     = BT_DISPATCH_OWNER_IMU,
+  [gattdb_es_uvindex]            = BT_DISPATCH_OWNER_LIGHT,
+  [gattdb_es_ambient_light]      = BT_DISPATCH_OWNER_LIGHT,
+  [gattdb_es_temperature]        = BT_DISPATCH_OWNER_RHT,
+  [gattdb_es_humidity]           = BT_DISPATCH_OWNER_RHT,
+};
+
+static bool dispatch_booted = false;
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+static void dispatch_all(sl_bt_msg_t *evt)
+{
+  for (size_t i = 0; i < sizeof(component_handlers) / sizeof(component_handlers[0]); i++) {
+    component_handlers[i](evt);
+  }
+}
+
+static void dispatch_attribute(sl_bt_msg_t *evt, uint16_t characteristic)
+{
+  if (characteristic < BT_DISPATCH_ATTRIBUTE_COUNT) {
+    bt_dispatch_handler_t handler = owner_handlers[attribute_owner[characteristic]];
+    if (handler != NULL) {
+      handler(evt);
+    }
+  }
+}
+
+// Stop if a characteristic generating user requests or status events has no
+// owner, rather than dropping its events at run time.
+static void check_attribute_owners(void)
+{
+  for (uint16_t i = 0; i + 1 < gattdb.attribute_num; i++) {
+    const sli_bt_gattdb_attribute_t *declaration = &gattdb.attributes[i];
+    const sli_bt_gattdb_attribute_t *value = &gattdb.attributes[i + 1];
+    if ((declaration->datatype != BT_DISPATCH_DATATYPE_CHARACTERISTIC)
+        || ((value->datatype != BT_DISPATCH_DATATYPE_USER)
+            && ((declaration->characteristic.properties & BT_DISPATCH_PROPERTIES_STATUS) == 0))) {
+      continue;
+    }
+    app_assert((value->handle < BT_DISPATCH_ATTRIBUTE_COUNT)
+               && (attribute_owner[value->handle] != BT_DISPATCH_OWNER_NONE),
+               "No owner in bt_dispatch.c for characteristic %u" APP_LOG_NL,
+               value->handle);
+  }
+  for (size_t i = BT_DISPATCH_OWNER_STACK + 1; i < BT_DISPATCH_OWNER_COUNT; i++) {
+    app_assert(owner_handlers[i] != NULL,
+               "No handler in bt_dispatch.c for owner %u" APP_LOG_NL,
+               (unsigned int)i);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+void bt_dispatch_process_event(sl_bt_msg_t *evt)
+{
+  switch (SL_BT_MSG_ID(evt->header)) {
+    case sl_bt_evt_gatt_server_user_read_request_id:
+      dispatch_attribute(evt, evt->data.evt_gatt_server_user_read_request.characteristic);
+      break;
+    case sl_bt_evt_gatt_server_user_write_request_id:
+      dispatch_attribute(evt, evt->data.evt_gatt_server_user_write_request.characteristic);
+      break;
+    case sl_bt_evt_gatt_server_characteristic_status_id:
+      dispatch_attribute(evt, evt->data.evt_gatt_server_characteristic_status.characteristic);
+      break;
+    case sl_bt_evt_system_boot_id:
+      dispatch_booted = true;
+      check_attribute_owners();
+      dispatch_all(evt);
+      break;
+    default:
+      dispatch_all(evt);
+      break;
+  }
+}
+
+bool bt_dispatch_is_booted(void)
+{
+  return dispatch_booted;
+}
+
+#endif // SL_BT_CONFIG_EVENT_DISPATCH_TABLE
@@ -0,0 +1,60 @@
+/***************************************************************************//**
+ * @file
+ * @brief Thunderboard Bluetooth event dispatch header
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#ifndef BT_DISPATCH_H
+#define BT_DISPATCH_H
+
+#include <stdbool.h>
+#include "sl_bluetooth.h"
+
+/***************************************************************************//**
+ * Pass a stack event to the components handling it.
+ *
+ * GATT server events about a characteristic go only to the component owning
+ * it, other events to every component. The boot event checks that every
+ * characteristic with user requests or status events has an owner. Replaces
+ * the fan-out to every component in sl_bt_process_event() when
+ * SL_BT_CONFIG_EVENT_DISPATCH_TABLE is enabled.
+ * @param[in] evt Event coming from the Bluetooth stack.
+ ******************************************************************************/
+void bt_dispatch_process_event(sl_bt_msg_t *evt);
+
+/***************************************************************************//**
+ * Check that bt_dispatch_process_event() saw the system boot event.
+ *
+ * False in the system boot event handler of the application means that a
+ * regenerated sl_bt_process_event() passes every event to every component
+ * again.
+ * @return True after the system boot event.
+ ******************************************************************************/
+bool bt_dispatch_is_booted(void);
+
+#endif // BT_DISPATCH_H
@@ -0,0 +1,233 @@
+/***************************************************************************//**
+ * @file
+ * @brief Thunderboard GATT subscription table
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "sl_bluetooth.h"
+#include "gatt_db.h"
+#include "bt_subscriptions.h"
+
+// -----------------------------------------------------------------------------
+// Private types
+
+// Notifying characteristics, by bit in the subscription masks. The Service
+// Changed characteristic is left to the stack.
+typedef enum {
+  BT_SUBSCRIPTION_AIO_DIGITAL_IN = 0,
+  BT_SUBSCRIPTION_BATT_MEASUREMENT,
+  BT_SUBSCRIPTION_HALL_STATE,
+  BT_SUBSCRIPTION_HALL_FIELD_STRENGTH,
+  BT_SUBSCRIPTION_IMU_ACCELERATION,
+  BT_SUBSCRIPTION_IMU_ORIENTATION,
+  BT_SUBSCRIPTION_IMU_CONTROL_POINT,
+  BT_SUBSCRIPTION_COUNT
+} bt_subscription_bit_t;
+
+typedef uint32_t bt_subscription_mask_t;
+
+_Static_assert(BT_SUBSCRIPTION_COUNT <= 8 * sizeof(bt_subscription_mask_t),
+               "Subscription masks must have a bit for every notifying characteristic");
+
+// Client configuration of the notifying characteristics of one connection
+typedef struct {
+  bool used;
+  uint8_t connection;
+  bt_subscription_mask_t notification;
+  bt_subscription_mask_t indication;
+} bt_subscription_t;
+
+// -----------------------------------------------------------------------------
+// Private variables
+
+static bt_subscription_t subscriptions[SL_BT_CONFIG_MAX_CONNECTIONS];
+static uint32_t subscription_skipped = 0;
+static bool subscription_booted = false;
+
+// Bit of the characteristic in the subscription masks plus one, by attribute
+// handle. Zero for characteristics without a bit.
+static const uint8_t subscription_bit[gattdb_ota_control + 1] = {
+  [gattdb_aio_digital_in]        = BT_SUBSCRIPTION_AIO_DIGITAL_IN + 1,
+  [gattdb_batt_measurement]      = BT_SUBSCRIPTION_BATT_MEASUREMENT + 1,
+  [gattdb_hall_state]            = BT_SUBSCRIPTION_HALL_STATE + 1,
+  [gattdb_hall_field_strength]   = BT_SUBSCRIPTION_HALL_FIELD_STRENGTH + 1,
+  [gattdb_imu_acceleration]      = BT_SUBSCRIPTION_IMU_ACCELERATION + 1,
+  [gattdb_imu_orientation]       = BT_SUBSCRIPTION_IMU_ORIENTATION + 1,
+  [gattdb_imu_control_point]     = BT_SUBSCRIPTION_IMU_CONTROL_POINT + 1,
+};
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+static bt_subscription_mask_t subscription_get_mask(uint16_t characteristic)
+{
+  if ((characteristic < sizeof(subscription_bit)) && (subscription_bit[characteristic] != 0)) {
+    return (bt_subscription_mask_t)1 << (subscription_bit[characteristic] - 1);
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+void bt_subscription_on_event(sl_bt_msg_t *evt)
+{
+  uint8_t slot;
+  bt_subscription_mask_t mask;
+
+  switch (SL_BT_MSG_ID(evt->header)) {
+    case sl_bt_evt_system_boot_id:
+      subscription_booted = true;
+      break;
+    case sl_bt_evt_connection_opened_id:
+      for (slot = 0; slot < SL_BT_CONFIG_MAX_CONNECTIONS; slot++) {
+        if (!subscriptions[slot].used) {
+          subscriptions[slot].used = true;
+          subscriptions[slot].connection = evt->data.evt_connection_opened.connection;
+          subscriptions[slot].notification = 0;
+          subscriptions[slot].indication = 0;
+          break;
+        }
+      }
+      break;
+    case sl_bt_evt_connection_closed_id:
+      slot = bt_subscription_find(evt->data.evt_connection_closed.connection);
+      if (slot != BT_SUBSCRIPTION_INVALID_SLOT) {
+        subscriptions[slot].used = false;
+      }
+      break;
+    case sl_bt_evt_gatt_server_characteristic_status_id:
+      if (sl_bt_gatt_server_client_config != (sl_bt_gatt_server_characteristic_status_flag_t)evt->data.evt_gatt_server_characteristic_status.status_flags) {
+        break;
+      }
+      mask = subscription_get_mask(evt->data.evt_gatt_server_characteristic_status.characteristic);
+      slot = bt_subscription_find(evt->data.evt_gatt_server_characteristic_status.connection);
+      if ((mask == 0) || (slot == BT_SUBSCRIPTION_INVALID_SLOT)) {
+        break;
+      }
+      subscriptions[slot].notification &= ~mask;
+      subscriptions[slot].indication &= ~mask;
+      if (evt->data.evt_gatt_server_characteristic_status.client_config_flags & sl_bt_gatt_notification) {
+        subscriptions[slot].notification |= mask;
+      }
+      if (evt->data.evt_gatt_server_characteristic_status.client_config_flags & sl_bt_gatt_indication) {
+        subscriptions[slot].indication |= mask;
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+bool bt_subscription_is_booted(void)
+{
+  return subscription_booted;
+}
+
+uint8_t bt_subscription_find(uint8_t connection)
+{
+  for (uint8_t slot = 0; slot < SL_BT_CONFIG_MAX_CONNECTIONS; slot++) {
+    if (subscriptions[slot].used && (subscriptions[slot].connection == connection)) {
+      return slot;
+    }
+  }
+  return BT_SUBSCRIPTION_INVALID_SLOT;
+}
+
+uint8_t bt_subscription_get(uint8_t slot, uint16_t characteristic, uint8_t *connection)
+{
+  bt_subscription_mask_t mask = subscription_get_mask(characteristic);
+  uint8_t flags = sl_bt_gatt_disable;
+
+  if ((slot >= SL_BT_CONFIG_MAX_CONNECTIONS) || !subscriptions[slot].used) {
+    return flags;
+  }
+  if (subscriptions[slot].notification & mask) {
+    flags |= sl_bt_gatt_notification;
+  }
+  if (subscriptions[slot].indication & mask) {
+    flags |= sl_bt_gatt_indication;
+  }
+  if (connection != NULL) {
+    *connection = subscriptions[slot].connection;
+  }
+  return flags;
+}
+
+uint8_t bt_subscription_count(uint16_t characteristic)
+{
+  uint8_t count = 0;
+  for (uint8_t slot = 0; slot < SL_BT_CONFIG_MAX_CONNECTIONS; slot++) {
+    if (bt_subscription_get(slot, characteristic, NULL) != sl_bt_gatt_disable) {
+      count++;
+    }
+  }
+  return count;
+}
+
+uint8_t bt_subscription_connection_count(void)
+{
+  uint8_t count = 0;
+  for (uint8_t slot = 0; slot < SL_BT_CONFIG_MAX_CONNECTIONS; slot++) {
+    if (subscriptions[slot].used) {
+      count++;
+    }
+  }
+  return count;
+}
+
+sl_status_t bt_subscription_notify_all(uint16_t characteristic,
+                                       size_t value_len,
+                                       const uint8_t *value)
+{
+  sl_status_t result = SL_STATUS_OK;
+  sl_status_t sc;
+  uint8_t connection;
+
+  for (uint8_t slot = 0; slot < SL_BT_CONFIG_MAX_CONNECTIONS; slot++) {
+    if (bt_subscription_get(slot, characteristic, &connection) == sl_bt_gatt_disable) {
+      continue;
+    }
+    sc = sl_bt_gatt_server_send_notification(connection, characteristic, value_len, value);
+    if (sc == SL_STATUS_NO_MORE_RESOURCE) {
+      // TX buffers of this connection are full, it misses this value only
+      subscription_skipped++;
+    } else if ((sc != SL_STATUS_OK) && (result == SL_STATUS_OK)) {
+      result = sc;
+    }
+  }
+  return result;
+}
+
+uint32_t bt_subscription_get_skipped_count(void)
+{
+  return subscription_skipped;
+}
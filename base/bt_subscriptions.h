@@ -0,0 +1,115 @@
+/***************************************************************************//**
+ * @file
+ * @brief Thunderboard GATT subscription table header
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#ifndef BT_SUBSCRIPTIONS_H
+#define BT_SUBSCRIPTIONS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "sl_status.h"
+#include "sl_bluetooth.h"
+
+// Slot returned for a connection without an entry in the table
+#define BT_SUBSCRIPTION_INVALID_SLOT    0xFF
+
+/***************************************************************************//**
+ * Bluetooth stack event handler.
+ *
+ * Keeps the per-connection client configuration of the notifying
+ * characteristics up to date. It must see the connection and characteristic
+ * status events before the GATT service components do, base.slcp registers it
+ * with a priority ahead of them.
+ * @param[in] evt Event coming from the Bluetooth stack.
+ ******************************************************************************/
+void bt_subscription_on_event(sl_bt_msg_t *evt);
+
+/***************************************************************************//**
+ * Check that bt_subscription_on_event() saw the system boot event.
+ *
+ * False in the system boot event handler of the application means that
+ * sl_bt_process_event() does not call bt_subscription_on_event(), and no
+ * characteristic would ever be notified.
+ * @return True after the system boot event.
+ ******************************************************************************/
+bool bt_subscription_is_booted(void);
+
+/***************************************************************************//**
+ * Get the table slot of a connection.
+ * @param[in] connection Connection handle.
+ * @return Slot of the connection, or BT_SUBSCRIPTION_INVALID_SLOT.
+ ******************************************************************************/
+uint8_t bt_subscription_find(uint8_t connection);
+
+/***************************************************************************//**
+ * Get the client configuration of a characteristic in a slot.
+ * @param[in] slot Table slot.
+ * @param[in] characteristic Attribute handle of the characteristic.
+ * @param[out] connection Connection of the slot if any flag is set, may be NULL.
+ * @return sl_bt_gatt_client_config_flag_t flags of the characteristic.
+ ******************************************************************************/
+uint8_t bt_subscription_get(uint8_t slot, uint16_t characteristic, uint8_t *connection);
+
+/***************************************************************************//**
+ * Get the number of connections that enabled notifications or indications.
+ * @param[in] characteristic Attribute handle of the characteristic.
+ * @return Number of subscribed connections.
+ ******************************************************************************/
+uint8_t bt_subscription_count(uint16_t characteristic);
+
+/***************************************************************************//**
+ * Get the number of open connections in the table.
+ *
+ * Counts the connection of the current connection opened event and no longer
+ * the one of the current connection closed event.
+ * @return Number of open connections.
+ ******************************************************************************/
+uint8_t bt_subscription_connection_count(void);
+
+/***************************************************************************//**
+ * Notify a value to every subscribed connection.
+ *
+ * A connection without free TX buffers skips the value.
+ * @param[in] characteristic Attribute handle of the characteristic.
+ * @param[in] value_len Length of the value.
+ * @param[in] value Value to notify.
+ * @return First error other than full TX buffers, or SL_STATUS_OK.
+ ******************************************************************************/
+sl_status_t bt_subscription_notify_all(uint16_t characteristic,
+                                       size_t value_len,
+                                       const uint8_t *value);
+
+/***************************************************************************//**
+ * Get the number of notifications skipped because of full TX buffers.
+ ******************************************************************************/
+uint32_t bt_subscription_get_skipped_count(void);
+
+#endif // BT_SUBSCRIPTIONS_H
@@ -0,0 +1,252 @@
+/***************************************************************************//**
+ * @file
+ * @brief Thunderboard sleep clock calibration scheduler
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "em_cmu.h"
+#include "em_emu.h"
+#include "sl_clock_manager.h"
+#include "sl_clock_manager_oscillator_config.h"
+#include "sl_power_manager.h"
+#include "nvm3_default.h"
+#include "app_timer.h"
+#include "app_log.h"
+#include "app_assert.h"
+#include "clock_cal.h"
+
+// -----------------------------------------------------------------------------
+// Configuration
+
+// Period of the temperature check
+#define CLOCK_CAL_CHECK_INTERVAL_MS     30000
+// Die temperature change that triggers a run, in 0.1 Celsius
+#define CLOCK_CAL_TEMP_DELTA            50
+// Longest time between two runs
+#define CLOCK_CAL_MAX_INTERVAL_MS       (15 * 60 * 1000)
+// Sleep clock cycles counted per measurement, 512 cycles give 600000 HFXO
+// counts (1.7 ppm resolution) in 15.6 ms
+#define CLOCK_CAL_LF_CYCLES             512
+// Delay before reading the result, covers CLOCK_CAL_LF_CYCLES
+#define CLOCK_CAL_MEASURE_MS            20
+// NVM3 key of the stored LFXO accuracy, in the application key range
+#define CLOCK_CAL_NVM3_KEY              0x5051
+
+// -----------------------------------------------------------------------------
+// Private macros
+
+#define CLOCK_CAL_LF_FREQ               32768UL
+
+// -----------------------------------------------------------------------------
+// Private variables
+
+static app_timer_t check_timer;
+static app_timer_t measure_timer;
+static bool measuring = false;
+static int32_t last_temp;           // die temperature at the last run, 0.1 C
+static uint32_t elapsed_ms;         // time since the last run
+static int32_t last_ppm = 0;        // sleep clock error of the last run
+// LFXO accuracy in effect, raised by runs and kept in NVM3
+static uint16_t stored_accuracy = SL_CLOCK_MANAGER_LFXO_PRECISION;
+
+// -----------------------------------------------------------------------------
+// Private function declarations
+
+static int32_t temperature_get(void);
+static void measure_start(void);
+static void check_timer_cb(app_timer_t *timer, void *data);
+static void measure_timer_cb(app_timer_t *timer, void *data);
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+void clock_cal_init_early(void)
+{
+  uint16_t accuracy;
+
+  // NVM3 is opened again with the same parameters by sl_platform_init(),
+  // which leaves this instance as is.
+  if ((nvm3_initDefault() != SL_STATUS_OK)
+      || (nvm3_readData(nvm3_defaultHandle,
+                        CLOCK_CAL_NVM3_KEY,
+                        &accuracy,
+                        sizeof(accuracy)) != ECODE_NVM3_OK)
+      || (accuracy == 0)) {
+    return;
+  }
+  // The configured precision is the lower bound, a stored run only widens it.
+  stored_accuracy = SL_MAX(accuracy, SL_CLOCK_MANAGER_LFXO_PRECISION);
+  if (CMU_ClockSelectGet(cmuClock_RTCC) == cmuSelect_LFXO) {
+    CMU_LFXOPrecisionSet(stored_accuracy);
+  }
+}
+
+void clock_cal_init(void)
+{
+  sl_status_t sc;
+
+  sc = app_timer_start(&check_timer,
+                       CLOCK_CAL_CHECK_INTERVAL_MS,
+                       check_timer_cb,
+                       NULL,
+                       true);
+  app_assert_status(sc);
+  measure_start();
+}
+
+int32_t clock_cal_get_ppm(void)
+{
+  return last_ppm;
+}
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+static int32_t temperature_get(void)
+{
+  return (int32_t)(EMU_TemperatureGet() * 10.0f);
+}
+
+static void measure_start(void)
+{
+  sl_status_t sc;
+  sl_clock_manager_clock_calibration_t lf;
+
+  switch (CMU_ClockSelectGet(cmuClock_RTCC)) {
+    case cmuSelect_LFXO:
+      lf = SL_CLOCK_MANAGER_CLOCK_CALIBRATION_LFXO;
+      break;
+    case cmuSelect_LFRCO:
+      lf = SL_CLOCK_MANAGER_CLOCK_CALIBRATION_LFRCO;
+      break;
+    default:
+      return;
+  }
+
+  // The reference must keep running until the count is read.
+  sl_power_manager_add_em_requirement(SL_POWER_MANAGER_EM1);
+  sc = sl_clock_manager_configure_rco_calibration(CLOCK_CAL_LF_CYCLES,
+                                                  lf,
+                                                  SL_CLOCK_MANAGER_CLOCK_CALIBRATION_HFXO,
+                                                  false);
+  if (sc != SL_STATUS_OK) {
+    sl_power_manager_remove_em_requirement(SL_POWER_MANAGER_EM1);
+    return;
+  }
+  sl_clock_manager_start_rco_calibration();
+  measuring = true;
+  sc = app_timer_start(&measure_timer,
+                       CLOCK_CAL_MEASURE_MS,
+                       measure_timer_cb,
+                       NULL,
+                       false);
+  app_assert_status(sc);
+}
+
+static void check_timer_cb(app_timer_t *timer, void *data)
+{
+  int32_t temp_delta = temperature_get() - last_temp;
+
+  (void)timer;
+  (void)data;
+
+  elapsed_ms += CLOCK_CAL_CHECK_INTERVAL_MS;
+  if (measuring) {
+    return;
+  }
+  if ((elapsed_ms >= CLOCK_CAL_MAX_INTERVAL_MS)
+      || (temp_delta >= CLOCK_CAL_TEMP_DELTA)
+      || (temp_delta <= -CLOCK_CAL_TEMP_DELTA)) {
+    measure_start();
+  }
+}
+
+static void measure_timer_cb(app_timer_t *timer, void *data)
+{
+  uint32_t count;
+  uint32_t hfxo_freq;
+  uint32_t expected;
+  int32_t ppm;
+  uint32_t accuracy;
+
+  (void)timer;
+  (void)data;
+
+  sl_clock_manager_wait_rco_calibration();
+  (void)sl_clock_manager_get_rco_calibration_count(&count);
+  sl_power_manager_remove_em_requirement(SL_POWER_MANAGER_EM1);
+  measuring = false;
+  if ((count == 0)
+      || (sl_clock_manager_get_oscillator_frequency(SL_OSCILLATOR_HFXO, &hfxo_freq) != SL_STATUS_OK)) {
+    return;
+  }
+  expected = (uint32_t)(((uint64_t)CLOCK_CAL_LF_CYCLES * hfxo_freq) / CLOCK_CAL_LF_FREQ);
+
+  // A fast sleep clock finishes its cycles early and lets fewer HFXO
+  // cycles through.
+  ppm = (int32_t)((((int64_t)expected - (int64_t)count) * 1000000) / (int64_t)count);
+
+  last_ppm = ppm;
+  last_temp = temperature_get();
+  elapsed_ms = 0;
+
+  app_log_info("Sleep clock: %ld ppm at %s%ld.%ld C" APP_LOG_NL,
+               (long)ppm,
+               (last_temp < 0) ? "-" : "",
+               (long)((last_temp < 0 ? -last_temp : last_temp) / 10),
+               (long)((last_temp < 0 ? -last_temp : last_temp) % 10));
+
+  // The link layer reads the sleep clock accuracy only when it initializes,
+  // so the result is stored for clock_cal_init_early() on the next boot. A
+  // single run does not bound the error over temperature, the worst one seen
+  // is kept. This also writes NVM3 only when the bound grows. The LFRCO
+  // precision is fixed by its mode and cannot be set, and series 2 parts
+  // without an LFRCO frequency trim cannot correct it either, so an LFRCO
+  // run is only logged.
+  if (CMU_ClockSelectGet(cmuClock_RTCC) != cmuSelect_LFXO) {
+    return;
+  }
+  // The measurement is only as good as the HFXO it counts against.
+  accuracy = (uint32_t)((ppm < 0) ? -ppm : ppm) + SL_CLOCK_MANAGER_HFXO_PRECISION;
+  accuracy = SL_MIN(accuracy, 0xFFFFUL);
+  if (accuracy <= stored_accuracy) {
+    return;
+  }
+  stored_accuracy = (uint16_t)accuracy;
+  if (nvm3_writeData(nvm3_defaultHandle,
+                     CLOCK_CAL_NVM3_KEY,
+                     &stored_accuracy,
+                     sizeof(stored_accuracy)) != ECODE_NVM3_OK) {
+    app_log_warning("Failed to store sleep clock accuracy" APP_LOG_NL);
+    return;
+  }
+  app_log_info("Sleep clock accuracy for next boot: %lu ppm" APP_LOG_NL,
+               (unsigned long)accuracy);
+}
@@ -0,0 +1,61 @@
+/***************************************************************************//**
+ * @file
+ * @brief Thunderboard sleep clock calibration scheduler header
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#ifndef CLOCK_CAL_H
+#define CLOCK_CAL_H
+
+#include <stdint.h>
+
+/***************************************************************************//**
+ * Apply the sleep clock accuracy found by earlier calibration runs.
+ *
+ * The Bluetooth link layer reads the accuracy only once when it initializes,
+ * so this must run before the stack does, e.g. from app_init_early().
+ ******************************************************************************/
+void clock_cal_init_early(void);
+
+/***************************************************************************//**
+ * Start the calibration scheduler.
+ *
+ * Measures the sleep clock against HFXO right away, then again whenever the
+ * die temperature moved or too much time elapsed since the last run. The
+ * worst accuracy seen is kept in NVM3 for clock_cal_init_early().
+ ******************************************************************************/
+void clock_cal_init(void);
+
+/***************************************************************************//**
+ * Get the sleep clock error found by the last calibration run.
+ *
+ * @return Error relative to HFXO in ppm, positive when the clock runs fast.
+ ******************************************************************************/
+int32_t clock_cal_get_ppm(void);
+
+#endif // CLOCK_CAL_H
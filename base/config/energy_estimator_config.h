@@ -0,0 +1,55 @@
+/***************************************************************************//**
+ * @file
+ * @brief Energy estimator configuration
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef ENERGY_ESTIMATOR_CONFIG_H
+#define ENERGY_ESTIMATOR_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <h> Energy estimator
+
+// <q ENERGY_ESTIMATOR_ENABLE> Record energy traces
+// <i> Records the time spent in each energy mode for each combination of
+// <i> radio activity, sensor activity and LEDs on, and logs it over VCOM when
+// <i> a connection opens or closes and before shutdown. tools/energy_replay
+// <i> replays the log against a current model and projects the battery life.
+// <i> Default: 0
+#define ENERGY_ESTIMATOR_ENABLE  0
+
+// <o ENERGY_ESTIMATOR_TRACE_SIZE> Number of activity states traced per period <4-64>
+// <i> Time spent in further states is counted as lost in the log.
+// <i> Default: 16
+#define ENERGY_ESTIMATOR_TRACE_SIZE  16
+
+// </h>
+
+// <<< end of configuration section >>>
+
+#endif // ENERGY_ESTIMATOR_CONFIG_H
@@ -0,0 +1,95 @@
+/***************************************************************************//**
+ * @file
+ * @brief NVM3 telemetry configuration
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef NVM3_TELEMETRY_CONFIG_H
+#define NVM3_TELEMETRY_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <h> NVM3 Telemetry
+
+// <q NVM3_TELEMETRY> Record repack and wear telemetry
+// <i> Counts repacks, page erases and writes per key range of every NVM3
+// <i> instance, see nvm3_getTelemetry(). The application logs them over VCOM
+// <i> when a connection closes and before shutdown.
+// <i> Default: 0
+#ifndef NVM3_TELEMETRY
+#define NVM3_TELEMETRY  0
+#endif
+
+// <h> Key map
+// <i> Key ranges the write statistics are split into. Keys in none of them
+// <i> are counted as other keys.
+
+// <o NVM3_TELEMETRY_KEY_USER_MIN> First application key <0x00000-0xFFFFF>
+// <i> Default: 0x00000
+#ifndef NVM3_TELEMETRY_KEY_USER_MIN
+#define NVM3_TELEMETRY_KEY_USER_MIN  0x00000
+#endif
+
+// <o NVM3_TELEMETRY_KEY_USER_MAX> Last application key <0x00000-0xFFFFF>
+// <i> Default: 0x0FFFF
+#ifndef NVM3_TELEMETRY_KEY_USER_MAX
+#define NVM3_TELEMETRY_KEY_USER_MAX  0x0FFFF
+#endif
+
+// <o NVM3_TELEMETRY_KEY_BLUETOOTH_MIN> First Bluetooth stack key <0x00000-0xFFFFF>
+// <i> Default: 0x40000
+#ifndef NVM3_TELEMETRY_KEY_BLUETOOTH_MIN
+#define NVM3_TELEMETRY_KEY_BLUETOOTH_MIN  0x40000
+#endif
+
+// <o NVM3_TELEMETRY_KEY_BLUETOOTH_MAX> Last Bluetooth stack key <0x00000-0xFFFFF>
+// <i> Default: 0x4FFFF
+#ifndef NVM3_TELEMETRY_KEY_BLUETOOTH_MAX
+#define NVM3_TELEMETRY_KEY_BLUETOOTH_MAX  0x4FFFF
+#endif
+
+// <o NVM3_TELEMETRY_KEY_PSA_ITS_MIN> First PSA internal trusted storage key <0x00000-0xFFFFF>
+// <i> SLI_PSA_ITS_NVM3_RANGE_BASE of the PSA driver.
+// <i> Default: 0x83100
+#ifndef NVM3_TELEMETRY_KEY_PSA_ITS_MIN
+#define NVM3_TELEMETRY_KEY_PSA_ITS_MIN  0x83100
+#endif
+
+// <o NVM3_TELEMETRY_KEY_PSA_ITS_MAX> Last PSA internal trusted storage key <0x00000-0xFFFFF>
+// <i> The base plus SLI_PSA_ITS_NVM3_RANGE_SIZE of the PSA driver, minus one.
+// <i> Default: 0x834FF
+#ifndef NVM3_TELEMETRY_KEY_PSA_ITS_MAX
+#define NVM3_TELEMETRY_KEY_PSA_ITS_MAX  0x834FF
+#endif
+
+// </h>
+
+// </h>
+
+// <<< end of configuration section >>>
+
+#endif // NVM3_TELEMETRY_CONFIG_H
@@ -88,6 +88,16 @@
 #define SL_BT_CONFIG_SET_CTUNE_FROM_NVM3  (0)
 // </e>
 
+// <q SL_BT_CONFIG_EVENT_DISPATCH_TABLE> Dispatch stack events to components through a lookup table
+// <i> Default: 1
+// <i> When enabled, GATT server events are passed only to the component owning the characteristic,
+// <i> found by attribute handle in a table built from gatt_db.h, and other stack events to every
+// <i> component. When disabled, every event is passed to every component.
+// <i> The owner table is kept in bt_dispatch.c and checked against config/btconf by
+// <i> tools/bt_dispatch when building. On boot, a characteristic with user requests or
+// <i> status events and no owner in the table stops the application with an assert.
+#define SL_BT_CONFIG_EVENT_DISPATCH_TABLE  (1)
+
 // </h> End Bluetooth Stack Configuration
 
 // <h> TX Power Levels
@@ -86,6 +86,24 @@
 //<i> Must be 64, 128, 192, [ n * 64 ], 1024, 2048, 3072, [ n * 1024 ] , 15360
 //<i> Default: 15360
 #define SL_DEBUG_SWO_SAMPLE_INTERVAL 15360
+
+// <o SL_DEBUG_SWO_BUFFER_SIZE> Buffered write size in bytes
+// <0=> Disabled
+// <128=> 128
+// <256=> 256
+// <512=> 512
+// <1024=> 1024
+// <2048=> 2048
+// <i> RAM buffer used by sl_debug_swo_write_buffered(). The application drains it
+// <i> with sl_debug_swo_process_action() and holds off EM2 with
+// <i> sl_debug_swo_is_ok_to_sleep().
+// <i> When enabled, the application log is written to ITM channel 0 through
+// <i> this buffer instead of the VCOM.
+// <i> Each write takes 2 bytes of header. At 875 kHz the SWO carries about
+// <i> 87 kB/s, so about 70 kB/s of data as word writes and 43 kB/s as byte
+// <i> writes. Writes that do not fit are dropped and counted.
+// <i> Default: 0
+#define SL_DEBUG_SWO_BUFFER_SIZE 0
 // </h>
 
 // <<< end of configuration section >>>
@@ -55,6 +55,12 @@
 // <o SL_POWER_MANAGER_DEBUG_POOL_SIZE> Maximum numbers of requirements that can be logged
 // <i> Default: 10
 #define SL_POWER_MANAGER_DEBUG_POOL_SIZE  10
+
+// <q SL_POWER_MANAGER_DEBUG_STATISTICS> Enable energy mode residency and wakeup statistics
+// <i> Accumulate the time spent in each energy mode, count wakeups per IRQ number
+// <i> and track how long each module holds its EM1 requirements.
+// <i> Default: 0
+#define SL_POWER_MANAGER_DEBUG_STATISTICS  0
 // </e>
 
 // <o SL_POWER_MANAGER_INIT_EMU_EM4_PIN_RETENTION_MODE> Pin retention mode
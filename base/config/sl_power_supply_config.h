@@ -0,0 +1,88 @@
+/***************************************************************************//**
+ * @file
+ * @brief Power supply configuration
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_POWER_SUPPLY_CONFIG_H
+#define SL_POWER_SUPPLY_CONFIG_H
+
+/***********************************************************************************************//**
+ * @addtogroup power_supply
+ * @{
+ **************************************************************************************************/
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <o SL_POWER_SUPPLY_PROBE_SETTLE_MS> Supply settling time before each internal resistance measurement [ms] <1-1000>
+// <i> Default: 250
+#define SL_POWER_SUPPLY_PROBE_SETTLE_MS  250
+
+// <o SL_POWER_SUPPLY_PROBE_SAMPLE_COUNT> Number of A/D samples averaged per probe measurement <1-64>
+// <i> Default: 16
+#define SL_POWER_SUPPLY_PROBE_SAMPLE_COUNT  16
+
+// <q SL_POWER_SUPPLY_PROBE_CACHE_ENABLE> Cache the detected supply in NVM3
+// <i> The supply type found by the probe is kept in NVM3 and reused after
+// <i> reset or EM4 wakeup as long as the supply voltage has not moved by more
+// <i> than the tolerance below. Supplies with the same voltage (e.g. AAA and
+// <i> CR2032 cells) cannot be told apart without a full probe.
+// <i> Default: 1
+#define SL_POWER_SUPPLY_PROBE_CACHE_ENABLE  1
+
+// <o SL_POWER_SUPPLY_PROBE_CACHE_NVM3_KEY> NVM3 key of the cached supply <0x0-0xFFFF>
+// <i> Must be in the application key range of the default NVM3 instance.
+// <i> Default: 0x5050
+#define SL_POWER_SUPPLY_PROBE_CACHE_NVM3_KEY  0x5050
+
+// <o SL_POWER_SUPPLY_PROBE_CACHE_TOLERANCE_MV> Supply voltage change forcing a full probe [mV] <1-1000>
+// <i> Default: 100
+#define SL_POWER_SUPPLY_PROBE_CACHE_TOLERANCE_MV  100
+
+// <o SL_POWER_SUPPLY_BATTERY_SMOOTHING> Battery voltage filter strength <0-6>
+// <i> Each battery level reading is averaged into the previous ones with a
+// <i> weight of 1 / 2^N. 0 disables the filter.
+// <i> Default: 2
+#define SL_POWER_SUPPLY_BATTERY_SMOOTHING  2
+
+// <o SL_POWER_SUPPLY_BATTERY_LEVEL_HYSTERESIS> Battery level rise reported at once [%] <1-100>
+// <i> A rise of the estimate by at least this amount (e.g. a new battery) is
+// <i> reported on the next reading.
+// <i> Default: 10
+#define SL_POWER_SUPPLY_BATTERY_LEVEL_HYSTERESIS  10
+
+// <o SL_POWER_SUPPLY_BATTERY_LEVEL_DWELL> Readings before a level change is reported <1-255>
+// <i> Any other change is only reported once the estimate stayed above, or
+// <i> below, the reported level for this many consecutive readings. A dip
+// <i> while the radio loads the battery is not reported, and a level reported
+// <i> during a long dip recovers once the voltage does.
+// <i> Default: 4
+#define SL_POWER_SUPPLY_BATTERY_LEVEL_DWELL  4
+// <<< end of configuration section >>>
+
+/** @} (end addtogroup power_supply) */
+#endif // SL_POWER_SUPPLY_CONFIG_H
@@ -78,6 +78,16 @@
 #define SL_RAIL_UTIL_PA_CALIBRATION_ENABLE  1
 // </h>
 
+// <h> PA Conversion Cache Configuration
+// <o SL_RAIL_UTIL_PA_CONVERSION_CACHE_SIZE> Precomputed power conversion table size (bytes) <0-4096>
+// <i> RAM holding dBm to raw and raw to dBm tables for every PA, built
+// <i> at init from the curves so conversions no longer walk them.
+// <i> A PA whose tables do not fit keeps using the curves; 0 disables.
+// <i> The xG22 HP and LP curves need about 940 bytes together.
+// <i> Default: 0
+#define SL_RAIL_UTIL_PA_CONVERSION_CACHE_SIZE  1024
+// </h>
+
 // <<< end of configuration section >>>
 
 #endif // SL_RAIL_UTIL_PA_CONFIG_H
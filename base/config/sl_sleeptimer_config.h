@@ -77,6 +77,24 @@
 // <i> Default: 0
 #define SL_SLEEPTIMER_DEBUGRUN  0
 
+#define SL_SLEEPTIMER_TIMER_QUEUE_DELTA_LIST 0
+#define SL_SLEEPTIMER_TIMER_QUEUE_HEAP       1
+
+// <o SL_SLEEPTIMER_TIMER_QUEUE> Timer queue implementation
+//   <SL_SLEEPTIMER_TIMER_QUEUE_DELTA_LIST=> Delta list
+//   <SL_SLEEPTIMER_TIMER_QUEUE_HEAP=> Binary min-heap
+// <i> The delta list has no limit on the number of running timers but
+// <i> inserting and removing a timer is O(n) in a critical section.
+// <i> The heap keeps absolute 64 bits deadlines and makes these O(log n),
+// <i> with a fixed maximum number of running timers.
+// <i> Default: SL_SLEEPTIMER_TIMER_QUEUE_DELTA_LIST
+#define SL_SLEEPTIMER_TIMER_QUEUE  SL_SLEEPTIMER_TIMER_QUEUE_DELTA_LIST
+
+// <o SL_SLEEPTIMER_TIMER_QUEUE_HEAP_SIZE> Maximum number of running timers (heap only) <1-255>
+// <i> Starting a timer when the heap is full returns SL_STATUS_NO_MORE_RESOURCE.
+// <i> Default: 32
+#define SL_SLEEPTIMER_TIMER_QUEUE_HEAP_SIZE  32
+
 #endif /* SLEEPTIMER_CONFIG_H */
 
 // <<< end of configuration section >>>
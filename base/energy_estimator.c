@@ -0,0 +1,343 @@
+/***************************************************************************//**
+ * @file
+ * @brief Thunderboard energy estimator
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#include "energy_estimator_config.h"
+
+#if ENERGY_ESTIMATOR_ENABLE
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sl_bluetooth.h"
+#include "sl_core.h"
+#include "sl_power_manager.h"
+#include "sl_sleeptimer.h"
+#include "app_log.h"
+#include "energy_estimator.h"
+
+#if SL_BT_CONFIG_USER_ADVERTISERS > 8
+#error The connectable flags of the advertising sets must fit in a byte.
+#endif
+
+// -----------------------------------------------------------------------------
+// Private types
+
+// What runs on top of the MCU energy mode. The radio is described by its
+// event intervals, the replay tool charges each event from its model.
+typedef struct {
+  uint8_t load_count[ENERGY_ESTIMATOR_LOAD_COUNT];
+  uint8_t adv_connectable;                              // bit per advertising set
+  uint16_t adv_interval[SL_BT_CONFIG_USER_ADVERTISERS]; // 0 if stopped
+  uint16_t conn_interval[SL_BT_CONFIG_MAX_CONNECTIONS]; // 0 if closed or unknown
+} energy_estimator_activity_t;
+
+typedef struct {
+  energy_estimator_activity_t activity;
+  uint64_t em_ticks[SL_POWER_MANAGER_EM3 + 1];
+} energy_estimator_state_t;
+
+typedef struct {
+  bool used;
+  uint8_t connection;
+} energy_estimator_link_t;
+
+// -----------------------------------------------------------------------------
+// Private function declarations
+
+static void accumulate(void);
+static bool activity_equal(const energy_estimator_activity_t *a,
+                           const energy_estimator_activity_t *b);
+static void activity_changed(void);
+static int8_t link_find(uint8_t connection);
+static void log_ticks(uint64_t ticks);
+static void on_em_transition(sl_power_manager_em_t from, sl_power_manager_em_t to);
+
+// -----------------------------------------------------------------------------
+// Private variables
+
+static energy_estimator_activity_t activity;
+static energy_estimator_link_t links[SL_BT_CONFIG_MAX_CONNECTIONS];
+static energy_estimator_state_t states[ENERGY_ESTIMATOR_TRACE_SIZE];
+static uint8_t state_count = 0;
+static energy_estimator_state_t *state = NULL;  // NULL when the trace is full
+static uint64_t lost_ticks = 0;
+static sl_power_manager_em_t em = SL_POWER_MANAGER_EM0;
+static uint32_t last_tick;
+
+static sl_power_manager_em_transition_event_handle_t em_event_handle;
+static const sl_power_manager_em_transition_event_info_t em_event_info = {
+  .event_mask = SL_POWER_MANAGER_EVENT_TRANSITION_ENTERING_EM0
+                | SL_POWER_MANAGER_EVENT_TRANSITION_ENTERING_EM1
+                | SL_POWER_MANAGER_EVENT_TRANSITION_ENTERING_EM2,
+  .on_event = on_em_transition
+};
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+void energy_estimator_init(void)
+{
+  last_tick = sl_sleeptimer_get_tick_count();
+  activity_changed();
+  sl_power_manager_subscribe_em_transition_event(&em_event_handle, &em_event_info);
+}
+
+void energy_estimator_set_load(energy_estimator_load_t load, uint8_t count)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  if ((load >= ENERGY_ESTIMATOR_LOAD_COUNT) || (activity.load_count[load] == count)) {
+    return;
+  }
+  CORE_ENTER_ATOMIC();
+  accumulate();
+  activity.load_count[load] = count;
+  activity_changed();
+  CORE_EXIT_ATOMIC();
+}
+
+void energy_estimator_set_advertiser(uint8_t handle, bool connectable, uint16_t interval)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  if (handle >= SL_BT_CONFIG_USER_ADVERTISERS) {
+    return;
+  }
+  CORE_ENTER_ATOMIC();
+  accumulate();
+  if (connectable) {
+    activity.adv_connectable |= (uint8_t)(1 << handle);
+  } else {
+    activity.adv_connectable &= (uint8_t)~(1 << handle);
+  }
+  activity.adv_interval[handle] = interval;
+  activity_changed();
+  CORE_EXIT_ATOMIC();
+}
+
+void energy_estimator_on_event(sl_bt_msg_t *evt)
+{
+  int8_t link;
+  CORE_DECLARE_IRQ_STATE;
+
+  switch (SL_BT_MSG_ID(evt->header)) {
+    case sl_bt_evt_connection_opened_id:
+      // The interval is reported by the following parameters event.
+      link = link_find(SL_BT_INVALID_CONNECTION_HANDLE);
+      if (link >= 0) {
+        links[link].used = true;
+        links[link].connection = evt->data.evt_connection_opened.connection;
+      }
+      return;
+
+    case sl_bt_evt_connection_parameters_id:
+      link = link_find(evt->data.evt_connection_parameters.connection);
+      if (link < 0) {
+        return;
+      }
+      CORE_ENTER_ATOMIC();
+      accumulate();
+      // Peripheral latency is ignored: a streaming link uses every event.
+      activity.conn_interval[link] = evt->data.evt_connection_parameters.interval;
+      activity_changed();
+      CORE_EXIT_ATOMIC();
+      return;
+
+    case sl_bt_evt_connection_closed_id:
+      link = link_find(evt->data.evt_connection_closed.connection);
+      if (link < 0) {
+        return;
+      }
+      links[link].used = false;
+      CORE_ENTER_ATOMIC();
+      accumulate();
+      activity.conn_interval[link] = 0;
+      activity_changed();
+      CORE_EXIT_ATOMIC();
+      return;
+
+    default:
+      return;
+  }
+}
+
+void energy_estimator_log_and_reset(const char *label)
+{
+  uint8_t i;
+  uint8_t j;
+  energy_estimator_state_t *s;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  accumulate();
+  CORE_EXIT_ATOMIC();
+
+  // The trace is only updated from the main loop, through the Bluetooth
+  // events, the app calls and the power manager sleep, so it can be logged
+  // without holding off interrupts.
+  app_log_info("EE_TRACE begin %s" APP_LOG_NL, label);
+  for (i = 0; i < state_count; i++) {
+    s = &states[i];
+    app_log_info("EE_TRACE state em=");
+    for (j = 0; j <= SL_POWER_MANAGER_EM3; j++) {
+      app_log_append("%s", (j == 0) ? "" : ",");
+      log_ticks(s->em_ticks[j]);
+    }
+    app_log_append(" load=");
+    for (j = 0; j < ENERGY_ESTIMATOR_LOAD_COUNT; j++) {
+      app_log_append("%s%u", (j == 0) ? "" : ",", s->activity.load_count[j]);
+    }
+    app_log_append(" adv=");
+    for (j = 0; j < SL_BT_CONFIG_USER_ADVERTISERS; j++) {
+      app_log_append("%s%u:%u",
+                     (j == 0) ? "" : ",",
+                     s->activity.adv_interval[j],
+                     (s->activity.adv_connectable >> j) & 1);
+    }
+    app_log_append(" conn=");
+    for (j = 0; j < SL_BT_CONFIG_MAX_CONNECTIONS; j++) {
+      app_log_append("%s%u", (j == 0) ? "" : ",", s->activity.conn_interval[j]);
+    }
+    app_log_nl();
+  }
+  app_log_info("EE_TRACE end lost=");
+  log_ticks(lost_ticks);
+  app_log_nl();
+
+  CORE_ENTER_ATOMIC();
+  accumulate();
+  state_count = 0;
+  lost_ticks = 0;
+  activity_changed();
+  CORE_EXIT_ATOMIC();
+}
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+// Charge the time since the last update to the current state.
+// Must be called inside a critical section.
+static void accumulate(void)
+{
+  uint32_t now = sl_sleeptimer_get_tick_count();
+  uint32_t elapsed = now - last_tick;
+
+  last_tick = now;
+  if ((state == NULL) || (em > SL_POWER_MANAGER_EM3)) {
+    lost_ticks += elapsed;
+    return;
+  }
+  state->em_ticks[em] += elapsed;
+}
+
+static bool activity_equal(const energy_estimator_activity_t *a,
+                           const energy_estimator_activity_t *b)
+{
+  uint8_t i;
+
+  if (a->adv_connectable != b->adv_connectable) {
+    return false;
+  }
+  for (i = 0; i < ENERGY_ESTIMATOR_LOAD_COUNT; i++) {
+    if (a->load_count[i] != b->load_count[i]) {
+      return false;
+    }
+  }
+  for (i = 0; i < SL_BT_CONFIG_USER_ADVERTISERS; i++) {
+    if (a->adv_interval[i] != b->adv_interval[i]) {
+      return false;
+    }
+  }
+  for (i = 0; i < SL_BT_CONFIG_MAX_CONNECTIONS; i++) {
+    if (a->conn_interval[i] != b->conn_interval[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Find the trace state of the current activity, or add it.
+// Must be called inside a critical section.
+static void activity_changed(void)
+{
+  uint8_t i;
+
+  for (i = 0; i < state_count; i++) {
+    if (activity_equal(&states[i].activity, &activity)) {
+      state = &states[i];
+      return;
+    }
+  }
+  if (state_count >= ENERGY_ESTIMATOR_TRACE_SIZE) {
+    state = NULL;
+    return;
+  }
+  state = &states[state_count++];
+  state->activity = activity;
+  for (i = 0; i <= SL_POWER_MANAGER_EM3; i++) {
+    state->em_ticks[i] = 0;
+  }
+}
+
+// Find the link of a connection, or a free slot for SL_BT_INVALID_CONNECTION_HANDLE.
+static int8_t link_find(uint8_t connection)
+{
+  for (uint8_t i = 0; i < SL_BT_CONFIG_MAX_CONNECTIONS; i++) {
+    if (connection == SL_BT_INVALID_CONNECTION_HANDLE) {
+      if (!links[i].used) {
+        return (int8_t)i;
+      }
+    } else if (links[i].used && (links[i].connection == connection)) {
+      return (int8_t)i;
+    }
+  }
+  return -1;
+}
+
+// Log a duration in milliseconds with microsecond resolution.
+static void log_ticks(uint64_t ticks)
+{
+  uint64_t us = (ticks * 1000000) / sl_sleeptimer_get_timer_frequency();
+
+  app_log_append("%lu.%03lu",
+                 (unsigned long)(us / 1000),
+                 (unsigned long)(us % 1000));
+}
+
+// Power manager energy mode transition callback, called with interrupts
+// disabled, before entering and after leaving sleep.
+static void on_em_transition(sl_power_manager_em_t from, sl_power_manager_em_t to)
+{
+  (void)from;
+  accumulate();
+  em = to;
+}
+
+#endif // ENERGY_ESTIMATOR_ENABLE
@@ -0,0 +1,93 @@
+/***************************************************************************//**
+ * @file
+ * @brief Thunderboard energy estimator header
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#ifndef ENERGY_ESTIMATOR_H
+#define ENERGY_ESTIMATOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sl_bluetooth.h"
+#include "energy_estimator_config.h"
+
+/// Loads traced by the energy estimator, on top of the MCU energy mode
+typedef enum {
+  ENERGY_ESTIMATOR_LOAD_SENSOR_SUPPLY,  ///< Sensor supply rail on, sensors idle
+  ENERGY_ESTIMATOR_LOAD_SI70XX,         ///< Si70xx conversion and its I2C transfers
+  ENERGY_ESTIMATOR_LOAD_SI1133,         ///< Si1133 conversion and its I2C transfers
+  ENERGY_ESTIMATOR_LOAD_LED,            ///< LEDs on
+  ENERGY_ESTIMATOR_LOAD_COUNT
+} energy_estimator_load_t;
+
+/***************************************************************************//**
+ * Initialize the energy estimator.
+ *
+ * Subscribes to the power manager energy mode transitions and starts
+ * tracing from now.
+ ******************************************************************************/
+void energy_estimator_init(void);
+
+/***************************************************************************//**
+ * Set how many instances of a load are active.
+ *
+ * @param[in] load Load to update.
+ * @param[in] count Number of active instances, e.g. LEDs on. 0 turns it off.
+ ******************************************************************************/
+void energy_estimator_set_load(energy_estimator_load_t load, uint8_t count);
+
+/***************************************************************************//**
+ * Set the state of an advertising set.
+ *
+ * @param[in] handle Advertising set handle.
+ * @param[in] connectable True if the set listens for connection requests.
+ * @param[in] interval Advertising interval (milliseconds * 1.6), 0 if stopped.
+ ******************************************************************************/
+void energy_estimator_set_advertiser(uint8_t handle, bool connectable, uint16_t interval);
+
+/***************************************************************************//**
+ * Bluetooth stack event handler.
+ *
+ * Tracks open connections and their connection interval.
+ * @param[in] evt Event coming from the Bluetooth stack.
+ ******************************************************************************/
+void energy_estimator_on_event(sl_bt_msg_t *evt);
+
+/***************************************************************************//**
+ * Log the trace recorded since the last reset, then start a new period.
+ *
+ * Each activity state seen is logged as one "EE_TRACE state" line with the
+ * time spent in each energy mode. tools/energy_replay turns a captured log
+ * into an average current and a battery life projection.
+ *
+ * @param[in] label Name of the period, e.g. the scenario it covered.
+ ******************************************************************************/
+void energy_estimator_log_and_reset(const char *label);
+
+#endif // ENERGY_ESTIMATOR_H
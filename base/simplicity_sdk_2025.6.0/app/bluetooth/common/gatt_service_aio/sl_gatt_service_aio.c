@@ -33,20 +33,46 @@
 #include "sl_status.h"
 #include "gatt_db.h"
 #include "app_assert.h"
+#include "sl_core.h"
+#include "sl_sleeptimer.h"
+#include "sl_bluetooth.h"
+#include "bt_subscriptions.h"
 #include "sli_gatt_service_aio.h"
 #include "sl_gatt_service_aio.h"
 
+#if (SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE & (SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE - 1)) \
+  || (SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE > 128)
+#error SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE must be a power of 2 not larger than 128.
+#endif
+
+#define AIO_EVENT_INDEX(i)  ((i) & (SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE - 1))
+
+// -----------------------------------------------------------------------------
+// Private types
+
+// Digital input state captured at a button edge
+typedef struct {
+  uint32_t timestamp;
+  uint8_t state;
+} aio_event_t;
+
 // -----------------------------------------------------------------------------
 // Private variables
 
-static bool aio_notification_enabled = false;
-static bool aio_button_changed = false;
-static uint8_t aio_connection = 0;
+static aio_event_t aio_event_queue[SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE];
+// Free running indexes, the head is written from interrupt context
+static volatile uint8_t aio_event_head = 0;
+static volatile uint8_t aio_event_tail = 0;
+static volatile uint32_t aio_event_overflow = 0;
+
+// Read position in the queue, by subscription table slot
+static uint8_t aio_event_next[SL_BT_CONFIG_MAX_CONNECTIONS];
 
 // -----------------------------------------------------------------------------
 // Private function declarations
 
-static void aio_digital_in_notify(void);
+static void aio_digital_in_notify(uint8_t connection);
+static void aio_event_queue_release(void);
 static void aio_system_boot_cb(void);
 static void aio_connection_opened_cb(sl_bt_evt_connection_opened_t *data);
 static void aio_connection_closed_cb(sl_bt_evt_connection_closed_t *data);
@@ -83,18 +109,38 @@ SL_WEAK void aio_digital_out_set_state(uint8_t state)
   (void)state;
 }
 
-static void aio_digital_in_notify(void)
+static void aio_digital_in_notify(uint8_t connection)
 {
   sl_status_t sc;
   uint8_t value = aio_digital_in_get_state();
   sc = sl_bt_gatt_server_send_notification(
-    aio_connection,
+    connection,
     gattdb_aio_digital_in,
     1,
     &value);
   app_assert_status(sc);
 }
 
+// Move the tail up to the oldest event still pending for any subscriber
+static void aio_event_queue_release(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+  uint8_t head = aio_event_head;
+  uint8_t pending_max = 0;
+
+  for (uint8_t slot = 0; slot < SL_BT_CONFIG_MAX_CONNECTIONS; slot++) {
+    if (bt_subscription_get(slot, gattdb_aio_digital_in, NULL) != sl_bt_gatt_disable) {
+      uint8_t pending = (uint8_t)(head - aio_event_next[slot]);
+      if (pending > pending_max) {
+        pending_max = pending;
+      }
+    }
+  }
+  CORE_ENTER_ATOMIC();
+  aio_event_tail = (uint8_t)(head - pending_max);
+  CORE_EXIT_ATOMIC();
+}
+
 static void aio_system_boot_cb(void)
 {
   sl_status_t sc;
@@ -110,17 +156,21 @@ static void aio_system_boot_cb(void)
 static void aio_connection_opened_cb(sl_bt_evt_connection_opened_t *data)
 {
   (void)data;
-  // Reset LED state
-  aio_digital_out_set_state(0);
+  // Reset LED state for the first client only, others share the outputs
+  if (bt_subscription_connection_count() <= 1) {
+    aio_digital_out_set_state(0);
+  }
 }
 
 static void aio_connection_closed_cb(sl_bt_evt_connection_closed_t *data)
 {
   (void)data;
-  // Reset LED state
-  aio_digital_out_set_state(0);
-  // Disable notifications
-  aio_notification_enabled = false;
+  // Reset LED state when the last client leaves
+  if (bt_subscription_connection_count() == 0) {
+    aio_digital_out_set_state(0);
+  }
+  // Notifications are already disabled in the subscription table
+  aio_event_queue_release();
 }
 
 static void aio_digital_in_read_cb(sl_bt_evt_gatt_server_user_read_request_t *data)
@@ -153,17 +203,19 @@ static void aio_digital_out_read_cb(sl_bt_evt_gatt_server_user_read_request_t *d
 
 static void aio_digital_in_changed_cb(sl_bt_evt_gatt_server_characteristic_status_t *data)
 {
-  aio_connection = data->connection;
+  uint8_t slot = bt_subscription_find(data->connection);
   // indication or notification enabled
   if (sl_bt_gatt_disable != data->client_config_flags) {
-    // enable notifications
-    aio_notification_enabled = true;
+    if (BT_SUBSCRIPTION_INVALID_SLOT != slot) {
+      // start with the events queued from now on
+      aio_event_next[slot] = aio_event_head;
+    }
     // send the first notification
-    aio_digital_in_notify();
+    aio_digital_in_notify(data->connection);
   }
   // indication and notification disabled
   else {
-    aio_notification_enabled = false;
+    aio_event_queue_release();
   }
 }
 
@@ -232,15 +284,66 @@ void sl_gatt_service_aio_on_event(sl_bt_msg_t *evt)
 
 void sl_gatt_service_aio_step(void)
 {
-  if (aio_button_changed) {
-    aio_button_changed = false;
-    aio_digital_in_notify();
+  sl_status_t sc;
+  aio_event_t *event;
+  uint8_t connection;
+  uint8_t tail = aio_event_tail;
+
+  if (tail == aio_event_head) {
+    return;
   }
+
+  for (uint8_t slot = 0; slot < SL_BT_CONFIG_MAX_CONNECTIONS; slot++) {
+    if (bt_subscription_get(slot, gattdb_aio_digital_in, &connection) == sl_bt_gatt_disable) {
+      continue;
+    }
+    while (aio_event_next[slot] != aio_event_head) {
+      event = &aio_event_queue[AIO_EVENT_INDEX(aio_event_next[slot])];
+      sc = sl_bt_gatt_server_send_notification(connection,
+                                               gattdb_aio_digital_in,
+                                               1,
+                                               &event->state);
+      if (SL_STATUS_NO_MORE_RESOURCE == sc) {
+        // Out of TX buffers, keep the rest for the next step
+        break;
+      }
+      if (SL_STATUS_OK == sc) {
+        aio_log_info("AIO in: 0x%02x at tick %lu to conn %d" AIO_LOG_NEW_LINE,
+                     event->state,
+                     (unsigned long)event->timestamp,
+                     connection);
+      }
+      aio_event_next[slot]++;
+    }
+  }
+
+  aio_event_queue_release();
 }
 
 void sl_gatt_service_aio_on_change(void)
 {
-  if (aio_notification_enabled) {
-    aio_button_changed = true;
+  CORE_DECLARE_IRQ_STATE;
+  uint32_t timestamp;
+  uint8_t state;
+
+  if (0 == bt_subscription_count(gattdb_aio_digital_in)) {
+    return;
+  }
+  timestamp = sl_sleeptimer_get_tick_count();
+  state = aio_digital_in_get_state();
+
+  CORE_ENTER_ATOMIC();
+  if ((uint8_t)(aio_event_head - aio_event_tail) >= SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE) {
+    aio_event_overflow++;
+  } else {
+    aio_event_queue[AIO_EVENT_INDEX(aio_event_head)].timestamp = timestamp;
+    aio_event_queue[AIO_EVENT_INDEX(aio_event_head)].state = state;
+    aio_event_head++;
   }
+  CORE_EXIT_ATOMIC();
+}
+
+uint32_t sl_gatt_service_aio_get_overflow_count(void)
+{
+  return aio_event_overflow;
 }
@@ -38,6 +38,11 @@
 
 #include "sl_bt_api.h"
 
+/// Number of push button events buffered until they are notified, power of 2.
+#ifndef SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE
+#define SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE  16
+#endif
+
 /**************************************************************************//**
  * Bluetooth stack event handler.
  * @param[in] evt Event coming from the Bluetooth stack.
@@ -50,9 +55,15 @@ void sl_gatt_service_aio_on_event(sl_bt_msg_t *evt);
 void sl_gatt_service_aio_on_change(void);
 
 /**************************************************************************//**
- * Push button event handler.
+ * Push button event handler, notifies the queued states to each subscriber.
  *****************************************************************************/
 void sl_gatt_service_aio_step(void);
 
+/**************************************************************************//**
+ * Get the number of push button events dropped because the queue was full.
+ * @return Number of dropped events since boot.
+ *****************************************************************************/
+uint32_t sl_gatt_service_aio_get_overflow_count(void);
+
 /** @} (end addtogroup gatt_service_aio) */
 #endif // SL_GATT_SERVICE_AIO_H
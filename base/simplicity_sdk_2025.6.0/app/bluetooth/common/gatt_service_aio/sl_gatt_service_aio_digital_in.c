@@ -42,7 +42,7 @@ uint8_t aio_digital_in_get_num(void)
 
 uint8_t aio_digital_in_get_state(void)
 {
-  // Read button states
+  // Read button states, also called from the button interrupt
   uint8_t aio_state = 0;
   sl_button_state_t btn_state;
 
@@ -51,7 +51,6 @@ uint8_t aio_digital_in_get_state(void)
     if (btn_state == SL_SIMPLE_BUTTON_PRESSED) {
       aio_state |= AIO_DIGITAL_STATE_ACTIVE << (i * AIO_DIGITAL_STATE_SIZE);
     }
-    aio_log_info("AIO in: %d=%d" AIO_LOG_NEW_LINE, i, btn_state);
   }
   return aio_state;
 }
@@ -33,23 +33,28 @@
 #include "app_timer.h"
 #include "gatt_db.h"
 #include "app_assert.h"
+#include "sl_bluetooth.h"
+#include "bt_subscriptions.h"
 #include "sl_gatt_service_battery.h"
 
 // -----------------------------------------------------------------------------
 // Configuration
 
 #define BATT_MEASUREMENT_INTERVAL_MS 10000
+// ATT error of reads before the first battery measurement. The Battery
+// Service defines no error codes, so this is the first application error
+// (0x80-0x9F); the common profile errors from 0xE0 mean other things.
+#define BATT_LEVEL_UNKNOWN_ATT_ERROR 0x80
 
 // -----------------------------------------------------------------------------
 // Private variables
 
 static app_timer_t batt_timer;
-static uint8_t batt_connection = 0;
 
 // -----------------------------------------------------------------------------
 // Private function declarations
 
-static void batt_measurement_notify(void);
+static void batt_measurement_notify(uint8_t connection);
 static void batt_timer_cb(app_timer_t *timer, void *data);
 static void batt_connection_closed_cb(sl_bt_evt_connection_closed_t *data);
 static void batt_measurement_read_cb(sl_bt_evt_gatt_server_user_read_request_t *data);
@@ -59,12 +64,16 @@ static void batt_measurement_changed_cb(sl_bt_evt_gatt_server_characteristic_sta
 // -----------------------------------------------------------------------------
 // Private function definitions
 
-static void batt_measurement_notify(void)
+static void batt_measurement_notify(uint8_t connection)
 {
   sl_status_t sc;
   uint8_t value = sl_gatt_service_battery_get_level();
+  if (SL_GATT_SERVICE_BATTERY_LEVEL_UNKNOWN == value) {
+    // the periodic notification follows once the level is known
+    return;
+  }
   sc = sl_bt_gatt_server_send_notification(
-    batt_connection,
+    connection,
     gattdb_batt_measurement,
     1,
     &value);
@@ -75,27 +84,40 @@ static void batt_timer_cb(app_timer_t *timer, void *data)
 {
   (void)data;
   (void)timer;
-  // send temperature measurement indication to connected client
-  batt_measurement_notify();
+  sl_status_t sc;
+  // measure once and notify every subscribed client
+  uint8_t value = sl_gatt_service_battery_get_level();
+  if (SL_GATT_SERVICE_BATTERY_LEVEL_UNKNOWN == value) {
+    return;
+  }
+  sc = bt_subscription_notify_all(gattdb_batt_measurement, 1, &value);
+  app_assert_status(sc);
 }
 
 static void batt_connection_closed_cb(sl_bt_evt_connection_closed_t *data)
 {
   (void)data;
   sl_status_t sc;
-  sc = app_timer_stop(&batt_timer);
-  app_assert_status(sc);
+  // stop the timer when the last subscriber is gone
+  if (0 == bt_subscription_count(gattdb_batt_measurement)) {
+    sc = app_timer_stop(&batt_timer);
+    app_assert_status(sc);
+  }
 }
 
 static void batt_measurement_read_cb(sl_bt_evt_gatt_server_user_read_request_t *data)
 {
   sl_status_t sc;
   uint8_t value = sl_gatt_service_battery_get_level();
+  uint8_t att_errorcode = 0;
+  if (SL_GATT_SERVICE_BATTERY_LEVEL_UNKNOWN == value) {
+    att_errorcode = BATT_LEVEL_UNKNOWN_ATT_ERROR;
+  }
   sc = sl_bt_gatt_server_send_user_read_response(
     data->connection,
     data->characteristic,
-    0,
-    1,
+    att_errorcode,
+    (att_errorcode == 0) ? 1 : 0,
     &value,
     NULL);
   app_assert_status(sc);
@@ -118,21 +140,22 @@ static void batt_type_read_cb(sl_bt_evt_gatt_server_user_read_request_t *data)
 static void batt_measurement_changed_cb(sl_bt_evt_gatt_server_characteristic_status_t *data)
 {
   sl_status_t sc;
-  batt_connection = data->connection;
   // indication or notification enabled
   if (sl_bt_gatt_disable != data->client_config_flags) {
-    // start timer used for periodic notifications
-    sc = app_timer_start(&batt_timer,
-                         BATT_MEASUREMENT_INTERVAL_MS,
-                         batt_timer_cb,
-                         NULL,
-                         true);
-    app_assert_status(sc);
+    // start timer used for periodic notifications with the first subscriber
+    if (1 == bt_subscription_count(gattdb_batt_measurement)) {
+      sc = app_timer_start(&batt_timer,
+                           BATT_MEASUREMENT_INTERVAL_MS,
+                           batt_timer_cb,
+                           NULL,
+                           true);
+      app_assert_status(sc);
+    }
     // Send the first notification
-    batt_measurement_notify();
+    batt_measurement_notify(data->connection);
   }
-  // indication and notifications disabled
-  else {
+  // indication and notifications disabled by the last subscriber
+  else if (0 == bt_subscription_count(gattdb_batt_measurement)) {
     // stop timer used for periodic notifications
     sc = app_timer_stop(&batt_timer);
     app_assert_status(sc);
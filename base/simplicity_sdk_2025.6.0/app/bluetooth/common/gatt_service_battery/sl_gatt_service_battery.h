@@ -38,6 +38,9 @@
 
 #include "sl_bt_api.h"
 
+/// Battery level not known yet. It is not notified and reads of it fail.
+#define SL_GATT_SERVICE_BATTERY_LEVEL_UNKNOWN 0xFF
+
 /**************************************************************************//**
  * Bluetooth stack event handler.
  * @param[in] evt Event coming from the Bluetooth stack.
@@ -46,7 +49,8 @@ void sl_gatt_service_battery_on_event(sl_bt_msg_t *evt);
 
 /**************************************************************************//**
  * Getter for Battery Level characteristic value.
- * @return Battery charge level percent (0..100).
+ * @return Battery charge level percent (0..100), or
+ *         SL_GATT_SERVICE_BATTERY_LEVEL_UNKNOWN.
  * @note To be implemented in user code.
  *****************************************************************************/
 uint8_t sl_gatt_service_battery_get_level(void);
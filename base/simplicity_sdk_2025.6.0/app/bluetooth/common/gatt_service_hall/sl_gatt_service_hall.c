@@ -35,6 +35,8 @@
 #include "app_timer.h"
 #include "gatt_db.h"
 #include "app_assert.h"
+#include "sl_bluetooth.h"
+#include "bt_subscriptions.h"
 #include "sl_gatt_service_hall.h"
 #include "sl_gatt_service_hall_config.h"
 
@@ -57,14 +59,12 @@
 // Private variables
 
 static app_timer_t hall_timer;
-static uint8_t hall_connection = 0;
+static bool hall_timer_running = false;
 
 // Field strength characteristic variables
-static bool hall_field_strength_notification = false;
 static int32_t hall_field_strength_value = 0;
 
 // State characteristic variables
-static bool hall_state_notification = false;
 static uint8_t hall_state_value = HALL_STATE_OPEN;
 static bool hall_tamper_latch = false;
 
@@ -72,8 +72,9 @@ static bool hall_tamper_latch = false;
 // Private function declarations
 
 static void hall_update(void);
-static void hall_field_strength_notify(void);
-static void hall_state_notify(void);
+static void hall_timer_update(void);
+static void hall_field_strength_notify(uint8_t connection);
+static void hall_state_notify(uint8_t connection);
 static void hall_timer_cb(app_timer_t *timer, void *data);
 static void hall_connection_closed_cb(sl_bt_evt_connection_closed_t *data);
 static void hall_char_read_cb(sl_bt_evt_gatt_server_user_read_request_t *data);
@@ -117,22 +118,44 @@ static void hall_update(void)
   }
 }
 
-static void hall_field_strength_notify(void)
+// Run the periodic timer while any of the notifications are enabled
+static void hall_timer_update(void)
+{
+  sl_status_t sc;
+  if (bt_subscription_count(gattdb_hall_field_strength)
+      || bt_subscription_count(gattdb_hall_state)) {
+    if (!hall_timer_running) {
+      sc = app_timer_start(&hall_timer,
+                           HALL_MEASUREMENT_INTERVAL_MS,
+                           hall_timer_cb,
+                           NULL,
+                           true);
+      app_assert_status(sc);
+      hall_timer_running = true;
+    }
+  } else {
+    sc = app_timer_stop(&hall_timer);
+    app_assert_status(sc);
+    hall_timer_running = false;
+  }
+}
+
+static void hall_field_strength_notify(uint8_t connection)
 {
   sl_status_t sc;
   sc = sl_bt_gatt_server_send_notification(
-    hall_connection,
+    connection,
     gattdb_hall_field_strength,
     sizeof(hall_field_strength_value),
     (uint8_t*)&hall_field_strength_value);
   app_assert_status(sc);
 }
 
-static void hall_state_notify(void)
+static void hall_state_notify(uint8_t connection)
 {
   sl_status_t sc;
   sc = sl_bt_gatt_server_send_notification(
-    hall_connection,
+    connection,
     gattdb_hall_state,
     sizeof(hall_state_value),
     (uint8_t*)&hall_state_value);
@@ -143,28 +166,29 @@ static void hall_timer_cb(app_timer_t * timer, void *data)
 {
   (void)data;
   (void)timer;
+  sl_status_t sc;
   uint8_t hall_state_old = hall_state_value;
 
+  // one measurement is shared by all subscribers
   hall_update();
 
-  if (hall_field_strength_notification) {
-    hall_field_strength_notify();
-  }
-  if (hall_state_notification && (hall_state_old != hall_state_value)) {
-    hall_state_notify();
+  sc = bt_subscription_notify_all(gattdb_hall_field_strength,
+                                  sizeof(hall_field_strength_value),
+                                  (uint8_t*)&hall_field_strength_value);
+  app_assert_status(sc);
+  if (hall_state_old != hall_state_value) {
+    sc = bt_subscription_notify_all(gattdb_hall_state,
+                                    sizeof(hall_state_value),
+                                    &hall_state_value);
+    app_assert_status(sc);
   }
 }
 
 static void hall_connection_closed_cb(sl_bt_evt_connection_closed_t * data)
 {
   (void)data;
-  sl_status_t sc;
-  // stop periodic timer
-  sc = app_timer_stop(&hall_timer);
-  app_assert_status(sc);
-  // reset notification flags
-  hall_field_strength_notification = false;
-  hall_state_notification = false;
+  // stop periodic timer if no other connection subscribed
+  hall_timer_update();
 }
 
 static void hall_char_read_cb(sl_bt_evt_gatt_server_user_read_request_t * data)
@@ -200,19 +224,15 @@ static void hall_char_read_cb(sl_bt_evt_gatt_server_user_read_request_t * data)
 
 static void hall_char_config_changed_cb(sl_bt_evt_gatt_server_characteristic_status_t * data)
 {
-  sl_status_t sc;
   bool enable = sl_bt_gatt_disable != data->client_config_flags;
-  void (*notify)(void) = NULL;
-  hall_connection = data->connection;
+  void (*notify)(uint8_t) = NULL;
 
-  // update notification status
+  // notification status is kept in the subscription table
   switch (data->characteristic) {
     case gattdb_hall_field_strength:
-      hall_field_strength_notification = enable;
       notify = &hall_field_strength_notify;
       break;
     case gattdb_hall_state:
-      hall_state_notification = enable;
       notify = &hall_state_notify;
       break;
     default:
@@ -224,21 +244,10 @@ static void hall_char_config_changed_cb(sl_bt_evt_gatt_server_characteristic_sta
     // update measurement data
     hall_update();
     // send the first notification
-    (*notify)();
+    (*notify)(data->connection);
   }
 
-  // start periodic timer if any of the notifications are enabled
-  if (hall_field_strength_notification || hall_state_notification) {
-    sc = app_timer_start(&hall_timer,
-                         HALL_MEASUREMENT_INTERVAL_MS,
-                         hall_timer_cb,
-                         NULL,
-                         true);
-    app_assert_status(sc);
-  } else {
-    sc = app_timer_stop(&hall_timer);
-    app_assert_status(sc);
-  }
+  hall_timer_update();
 }
 
 static void hall_char_write_cb(sl_bt_evt_gatt_server_user_write_request_t * data)
@@ -265,9 +274,10 @@ static void hall_char_write_cb(sl_bt_evt_gatt_server_user_write_request_t * data
     // reset tamper latch
     hall_tamper_latch = false;
     hall_update();
-    if (hall_state_notification) {
-      hall_state_notify();
-    }
+    sc = bt_subscription_notify_all(gattdb_hall_state,
+                                    sizeof(hall_state_value),
+                                    &hall_state_value);
+    app_assert_status(sc);
   }
 }
 
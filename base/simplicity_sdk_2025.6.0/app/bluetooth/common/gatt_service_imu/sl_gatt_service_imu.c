@@ -32,6 +32,8 @@
 #include "sl_status.h"
 #include "gatt_db.h"
 #include "app_assert.h"
+#include "sl_bluetooth.h"
+#include "bt_subscriptions.h"
 #include "sl_gatt_service_imu.h"
 #include "sl_gatt_service_imu_config.h"
 
@@ -57,15 +59,14 @@
 #define IMU_CP_RESP_ERROR                   0x02
 // Client Characteristic Configuration descriptor improperly configured
 #define IMU_CP_ERR_CCCD_CONF                0x81
+// Procedure Already in Progress, for another connection
+#define IMU_CP_ERR_IN_PROGRESS              0xFE
 
 // -----------------------------------------------------------------------------
 // Private variables
 
-static uint8_t imu_connection = 0;
+static uint8_t imu_cp_connection = 0;
 static bool imu_state = false; /* disabled / enabled */
-static bool imu_acceleration_notification = false;
-static bool imu_orientation_notification = false;
-static bool imu_control_pont_indication = false;
 static int16_t imu_avec[3] = { 0, 0, 0 };
 static int16_t imu_ovec[3] = { 0, 0, 0 };
 static uint8_t imu_cp_opcode;
@@ -80,8 +81,6 @@ static enum {
 // Private function declarations
 
 static void imu_update_state(void);
-static void imu_acceleration_notify(void);
-static void imu_orientation_notify(void);
 static void imu_control_point_indicate(void);
 static void imu_connection_closed_cb(sl_bt_evt_connection_closed_t *data);
 static void imu_char_config_changed_cb(sl_bt_evt_gatt_server_characteristic_status_t *data);
@@ -93,38 +92,13 @@ static void imu_char_write_cb(sl_bt_evt_gatt_server_user_write_request_t *data);
 static void imu_update_state(void)
 {
   bool imu_state_old = imu_state;
-  imu_state = imu_acceleration_notification || imu_orientation_notification;
+  imu_state = bt_subscription_count(gattdb_imu_acceleration)
+              || bt_subscription_count(gattdb_imu_orientation);
   if (imu_state_old != imu_state) {
     sl_gatt_service_imu_enable(imu_state);
   }
 }
 
-static void imu_acceleration_notify(void)
-{
-  sl_status_t sc;
-  sc = sl_bt_gatt_server_send_notification(
-    imu_connection,
-    gattdb_imu_acceleration,
-    sizeof(imu_avec),
-    (uint8_t*)imu_avec);
-  if (sc != SL_STATUS_OK) {
-    imu_log_error("[E: 0x%04x] Failed to send characteristic notification" IMU_LOG_NEW_LINE, (int)sc);
-  }
-}
-
-static void imu_orientation_notify(void)
-{
-  sl_status_t sc;
-  sc = sl_bt_gatt_server_send_notification(
-    imu_connection,
-    gattdb_imu_orientation,
-    sizeof(imu_ovec),
-    (uint8_t*)imu_ovec);
-  if (sc != SL_STATUS_OK) {
-    imu_log_error("[E: 0x%04x] Failed to send characteristic notification" IMU_LOG_NEW_LINE, (int)sc);
-  }
-}
-
 static void imu_control_point_indicate(void)
 {
   sl_status_t sc;
@@ -133,7 +107,7 @@ static void imu_control_point_indicate(void)
   switch (imu_cp_indication_status) {
     case IMU_CP_IND_IDLE:
       sc = sl_bt_gatt_server_send_indication(
-        imu_connection,
+        imu_cp_connection,
         gattdb_imu_control_point,
         sizeof(response),
         response);
@@ -155,29 +129,19 @@ static void imu_control_point_indicate(void)
 
 static void imu_connection_closed_cb(sl_bt_evt_connection_closed_t *data)
 {
-  (void)data;
-  imu_acceleration_notification = false;
-  imu_orientation_notification = false;
-  imu_control_pont_indication = false;
-  imu_cp_indication_status = IMU_CP_IND_IDLE;
+  if (data->connection == imu_cp_connection) {
+    imu_cp_indication_status = IMU_CP_IND_IDLE;
+  }
   imu_update_state();
 }
 
 static void imu_char_config_changed_cb(sl_bt_evt_gatt_server_characteristic_status_t *data)
 {
-  bool enable = sl_bt_gatt_disable != data->client_config_flags;
-  imu_connection = data->connection;
-
-  // update notification status
+  // notification status is kept in the subscription table
   switch (data->characteristic) {
     case gattdb_imu_acceleration:
-      imu_acceleration_notification = enable;
-      break;
     case gattdb_imu_orientation:
-      imu_orientation_notification = enable;
-      break;
     case gattdb_imu_control_point:
-      imu_control_pont_indication = enable;
       break;
     default:
       app_assert(false, "Unexpected characteristic" IMU_LOG_NEW_LINE);
@@ -192,7 +156,15 @@ static void imu_char_write_cb(sl_bt_evt_gatt_server_user_write_request_t *data)
   uint8_t att_errorcode = 0;
 
   if (data->value.len == 1) {
-    if (imu_control_pont_indication) {
+    if (sl_bt_gatt_disable == bt_subscription_get(bt_subscription_find(data->connection),
+                                                  gattdb_imu_control_point,
+                                                  NULL)) {
+      att_errorcode = IMU_CP_ERR_CCCD_CONF;
+    } else if ((IMU_CP_IND_IDLE != imu_cp_indication_status)
+               && (data->connection != imu_cp_connection)) {
+      att_errorcode = IMU_CP_ERR_IN_PROGRESS;
+    } else {
+      imu_cp_connection = data->connection;
       imu_cp_opcode = data->value.data[0];
       imu_cp_status = IMU_CP_RESP_ERROR;
 
@@ -209,8 +181,6 @@ static void imu_char_write_cb(sl_bt_evt_gatt_server_user_write_request_t *data)
           imu_cp_status = IMU_CP_RESP_SUCCESS;
           break;
       }
-    } else {
-      att_errorcode = IMU_CP_ERR_CCCD_CONF;
     }
   } else {
     att_errorcode = 0x0D; // Invalid Attribute Value Length
@@ -247,6 +217,9 @@ void sl_gatt_service_imu_on_event(sl_bt_msg_t *evt)
       } else if ((sl_bt_gatt_server_confirmation == (sl_bt_gatt_server_characteristic_status_flag_t)evt->data.evt_gatt_server_characteristic_status.status_flags)
                  && (gattdb_imu_control_point == evt->data.evt_gatt_server_user_read_request.characteristic)) {
         // confirmation of indication received from remove GATT client
+        if (evt->data.evt_gatt_server_characteristic_status.connection != imu_cp_connection) {
+          break;
+        }
         if (IMU_CP_IND_WAITING == imu_cp_indication_status) {
           imu_cp_indication_status = IMU_CP_IND_IDLE;
           imu_control_point_indicate();
@@ -276,11 +249,18 @@ void sl_gatt_service_imu_step(void)
           imu_avec[i] = SL_GATT_SERVICE_IMU_AVEC_INVALID;
         }
       }
-      if (imu_acceleration_notification) {
-        imu_acceleration_notify();
+      // one sample is shared by all subscribers
+      sc = bt_subscription_notify_all(gattdb_imu_acceleration,
+                                      sizeof(imu_avec),
+                                      (uint8_t*)imu_avec);
+      if (sc != SL_STATUS_OK) {
+        imu_log_error("[E: 0x%04x] Failed to send characteristic notification" IMU_LOG_NEW_LINE, (int)sc);
       }
-      if (imu_orientation_notification) {
-        imu_orientation_notify();
+      sc = bt_subscription_notify_all(gattdb_imu_orientation,
+                                      sizeof(imu_ovec),
+                                      (uint8_t*)imu_ovec);
+      if (sc != SL_STATUS_OK) {
+        imu_log_error("[E: 0x%04x] Failed to send characteristic notification" IMU_LOG_NEW_LINE, (int)sc);
       }
     }
   }
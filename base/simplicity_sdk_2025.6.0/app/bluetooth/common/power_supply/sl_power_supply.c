@@ -35,17 +35,27 @@
 #include "em_adc.h"
 #elif defined(IADC_PRESENT)
 #include "em_iadc.h"
+#include "em_emu.h"
+#include "sl_core.h"
 #endif
 
 #include "sl_board_control.h"
 #include "sl_sleeptimer.h"
+#include "sl_udelay.h"
 #include "sl_si70xx.h"
 #include "sl_i2cspm_instances.h"
 
 #include "app_assert.h"
 #include "sl_power_supply.h"
+#include "sl_power_supply_config.h"
 
 #include "sl_component_catalog.h"
+#ifdef SL_CATALOG_POWER_MANAGER_PRESENT
+#include "sl_power_manager.h"
+#endif // SL_CATALOG_POWER_MANAGER_PRESENT
+#if SL_POWER_SUPPLY_PROBE_CACHE_ENABLE
+#include "nvm3_default.h"
+#endif // SL_POWER_SUPPLY_PROBE_CACHE_ENABLE
 #ifdef SL_CATALOG_APP_LOG_PRESENT
 #include "app_log.h"
 #include "app_log_config.h"
@@ -74,6 +84,22 @@
   #define ADC_SCALE_FACTOR   (4.84f / 4095.0f)
 #endif
 
+#if defined(ADC_PRESENT)
+  #define ADC_FULL_SCALE_MV  5000u
+#elif defined(IADC_PRESENT)
+  #define ADC_FULL_SCALE_MV  4840u
+#endif
+#define ADC_MAX_CODE         4095u
+
+// Battery level lookup table covering the battery model with 10 mV steps
+#define BATT_LEVEL_STEP_MV   10u
+#define BATT_LEVEL_MIN_MV    2000u
+#define BATT_LEVEL_MAX_MV    3000u
+#define BATT_LEVEL_TABLE_SIZE ((BATT_LEVEL_MAX_MV - BATT_LEVEL_MIN_MV) / BATT_LEVEL_STEP_MV + 1)
+
+// Fractional bits of the filtered battery voltage
+#define BATT_FILTER_SHIFT    4u
+
 // -----------------------------------------------------------------------------
 // Private type definitions
 
@@ -82,6 +108,21 @@ typedef struct {
   uint8_t capacity;
 } batt_model_entry_t;
 
+typedef enum {
+  PROBE_STATE_IDLE,             ///< No probe in progress
+  PROBE_STATE_MEASURE_SUPPLY,   ///< Sampling the supply voltage
+  PROBE_STATE_SETTLE_UNLOADED,  ///< Waiting for the sensor and supply to settle
+  PROBE_STATE_MEASURE_UNLOADED, ///< Sampling the unloaded supply voltage
+  PROBE_STATE_SETTLE_LOADED,    ///< Waiting for the loaded supply to settle
+  PROBE_STATE_MEASURE_LOADED    ///< Sampling the loaded supply voltage
+} probe_state_t;
+
+typedef struct {
+  float voltage;
+  float ir;
+  uint8_t type;
+} probe_cache_t;
+
 // -----------------------------------------------------------------------------
 // Private variables
 
@@ -89,6 +130,24 @@ static float supply_voltage = 0.0f;                         ///< Supply voltage
 static float supply_ir = 0.0f;                              ///< Internal resistance of the supply
 static uint8_t supply_type = SL_POWER_SUPPLY_TYPE_UNKNOWN;  ///< Type of the connected supply
 
+// Asynchronous probe
+static volatile probe_state_t probe_state = PROBE_STATE_IDLE;
+static volatile bool probe_samples_ready = false;
+static volatile uint32_t probe_sample_sum = 0;
+static volatile uint8_t probe_sample_count = 0;
+static float probe_voltage_unloaded = 0.0f;
+static sl_sleeptimer_timer_handle_t probe_timer;
+static sl_power_supply_probe_callback_t probe_callback = NULL;
+
+// Battery level estimation
+static bool adc_initialized = false;
+static bool batt_level_table_ready = false;
+static uint8_t batt_level_table[BATT_LEVEL_TABLE_SIZE];
+static uint32_t batt_filter_mv = 0;      ///< Filtered voltage, mV << BATT_FILTER_SHIFT
+static uint8_t batt_level = SL_POWER_SUPPLY_BATTERY_LEVEL_UNKNOWN; ///< Last reported battery level
+static bool batt_level_falling = false; ///< Direction of the pending change
+static uint8_t batt_level_dwell = 0;     ///< Consecutive readings of the pending change
+
 static batt_model_entry_t batt_model_cr2032[] =
 { { 3.0, 100 }, { 2.9, 80 }, { 2.8, 60 }, { 2.7, 40 }, { 2.6, 30 },
   { 2.5, 20 }, { 2.4, 10 }, { 2.0, 0 } };
@@ -139,12 +198,87 @@ static float measure_supply_ir(uint8_t load_setting);
  ******************************************************************************/
 static uint8_t calculate_level(float voltage, batt_model_entry_t *model, uint8_t model_entry_count);
 
+/***************************************************************************//**
+ * Fill the battery level lookup table from the battery model.
+ ******************************************************************************/
+static void batt_level_table_init(void);
+
+/***************************************************************************//**
+ * Look up the battery level of a voltage in the battery level table,
+ * interpolating between the neighbouring entries.
+ *
+ * @param[in] voltage_mv Battery voltage in mV.
+ * @return The estimated battery capacity level in percent.
+ ******************************************************************************/
+static uint8_t batt_level_lookup(uint32_t voltage_mv);
+
+/***************************************************************************//**
+ * Classify the supply by its internal resistance.
+ *
+ * @param[in] ir Internal resistance of the supply.
+ * @return Power supply type.
+ ******************************************************************************/
+static uint8_t classify_supply(float ir);
+
+/***************************************************************************//**
+ * Start averaging A/D samples in the background.
+ *
+ * The probe state machine is notified through probe_samples_ready when
+ * SL_POWER_SUPPLY_PROBE_SAMPLE_COUNT samples have been collected.
+ ******************************************************************************/
+static void probe_start_sampling(void);
+
+/***************************************************************************//**
+ * Get the average voltage of the samples collected in the background.
+ *
+ * @return The measured voltage.
+ ******************************************************************************/
+static float probe_get_voltage(void);
+
+/***************************************************************************//**
+ * Sleeptimer callback ending a settling period of the probe.
+ *
+ * @param[in] handle Sleeptimer handle.
+ * @param[in] data Unused.
+ ******************************************************************************/
+static void probe_timer_cb(sl_sleeptimer_timer_handle_t *handle, void *data);
+
+/***************************************************************************//**
+ * Store the probe results and notify the application.
+ *
+ * @param[in] type Power supply type.
+ * @param[in] voltage Supply voltage.
+ * @param[in] ir Internal resistance of the supply.
+ ******************************************************************************/
+static void probe_finish(uint8_t type, float voltage, float ir);
+
+/***************************************************************************//**
+ * Set the load of the Si7021 heater.
+ *
+ * @param[in] enable True to turn on the heater.
+ * @param[in] load_setting Heater current setting of the Si7021.
+ ******************************************************************************/
+static void heater_set(bool enable, uint8_t load_setting);
+
+/***************************************************************************//**
+ * Get the supply current drawn by the Si7021 heater.
+ *
+ * @param[in] load_setting Heater current setting of the Si7021.
+ * @return The heater current in A.
+ ******************************************************************************/
+static float heater_current(uint8_t load_setting);
+
 // -----------------------------------------------------------------------------
 // Private function definitions
 
 static void adc_init(void)
 {
   sl_status_t sc;
+
+  // The configuration is kept between measurements.
+  if (adc_initialized) {
+    return;
+  }
 #if defined(ADC_PRESENT)
   ADC_Init_TypeDef init = ADC_INIT_DEFAULT;
   ADC_InitSingle_TypeDef init_single = ADC_INITSINGLE_DEFAULT;
@@ -188,8 +322,8 @@ static void adc_init(void)
   input.posInput = iadcPosInputAvdd;
 
   IADC_initSingle(IADC0, &init_single, &input);
-  IADC_enableInt(IADC0, IADC_IEN_SINGLEDONE);
 #endif
+  adc_initialized = true;
   return;
 }
 
@@ -202,6 +336,21 @@ static uint16_t get_adc_sample(void)
 
   return ADC_DataSingleGet(ADC0);
 #elif defined(IADC_PRESENT)
+  CORE_DECLARE_IRQ_STATE;
+
+  // The interrupt is enabled only while the background probe samples, let
+  // it finish, as its handler would take this result. Sleep in EM1, which
+  // the probe requires, until its last conversion. The check and the sleep
+  // run with interrupts masked so the wakeup cannot be missed; the handler
+  // runs when they are unmasked.
+  CORE_ENTER_CRITICAL();
+  while ( IADC0->IEN & IADC_IEN_SINGLEDONE ) {
+    EMU_EnterEM1();
+    CORE_EXIT_CRITICAL();
+    CORE_ENTER_CRITICAL();
+  }
+  CORE_EXIT_CRITICAL();
+
   // Clear single done interrupt
   IADC_clearInt(IADC0, IADC_IF_SINGLEDONE);
 
@@ -243,31 +392,20 @@ static float measure_supply_ir(uint8_t loadSetting)
   float supplyVoltageLoad;
   float i, r;
 
-  uint8_t cmd;
-  uint8_t data;
-
-  sl_sleeptimer_delay_millisecond(250);
-  supplyVoltage = sl_power_supply_measure_voltage(16);
+  sl_udelay_sleep(SL_POWER_SUPPLY_PROBE_SETTLE_MS * 1000U);
+  supplyVoltage = sl_power_supply_measure_voltage(SL_POWER_SUPPLY_PROBE_SAMPLE_COUNT);
 
   // Enable heater in Si7021 - 9.81 mA
-  cmd = SI7021_CMD_WRITE_HEATER_CTRL;
-  data = loadSetting;
-  si7021_cmd_write(&cmd, 1, &data, 1);
-
-  cmd = SI7021_CMD_WRITE_USER_REG1;
-  data = 0x04;
-  si7021_cmd_write(&cmd, 1, &data, 1);
+  heater_set(true, loadSetting);
 
   // Wait for battery voltage to settle.
-  sl_sleeptimer_delay_millisecond(250);
-  supplyVoltageLoad = sl_power_supply_measure_voltage(16);
+  sl_udelay_sleep(SL_POWER_SUPPLY_PROBE_SETTLE_MS * 1000U);
+  supplyVoltageLoad = sl_power_supply_measure_voltage(SL_POWER_SUPPLY_PROBE_SAMPLE_COUNT);
 
   // Turn off heater.
-  cmd = SI7021_CMD_WRITE_USER_REG1;
-  data = 0x00;
-  si7021_cmd_write(&cmd, 1, &data, 1);
+  heater_set(false, loadSetting);
 
-  i = 0.006074 * loadSetting + 0.00309;
+  i = heater_current(loadSetting);
   r = (supplyVoltage - supplyVoltageLoad) / i;
 
   power_supply_log_info("Power supply - sv = %.3f   svl = %.3f   i = %.3f   r = %.3f" POWER_SUPPLY_LOG_NEW_LINE,
@@ -276,6 +414,98 @@ static float measure_supply_ir(uint8_t loadSetting)
   return r;
 }
 
+static void heater_set(bool enable, uint8_t load_setting)
+{
+  uint8_t cmd;
+  uint8_t data;
+
+  if (enable) {
+    cmd = SI7021_CMD_WRITE_HEATER_CTRL;
+    data = load_setting;
+    si7021_cmd_write(&cmd, 1, &data, 1);
+  }
+
+  cmd = SI7021_CMD_WRITE_USER_REG1;
+  data = enable ? 0x04 : 0x00;
+  si7021_cmd_write(&cmd, 1, &data, 1);
+}
+
+static float heater_current(uint8_t load_setting)
+{
+  return 0.006074f * (float)load_setting + 0.00309f;
+}
+
+static uint8_t classify_supply(float ir)
+{
+  uint8_t type;
+
+  if ( ir > 5.0f ) {
+    type = SL_POWER_SUPPLY_TYPE_CR2032;
+  } else if (ir > 0.5f) {
+    type = SL_POWER_SUPPLY_TYPE_AAA;
+  } else {
+    type = SL_POWER_SUPPLY_TYPE_USB;
+  }
+
+  return type;
+}
+
+static void probe_start_sampling(void)
+{
+  probe_sample_sum = 0;
+  probe_sample_count = 0;
+  probe_samples_ready = false;
+#if defined(IADC_PRESENT)
+#ifdef SL_CATALOG_POWER_MANAGER_PRESENT
+  // Keep the IADC clocked until the last conversion is done.
+  sl_power_manager_add_em_requirement(SL_POWER_MANAGER_EM1);
+#endif // SL_CATALOG_POWER_MANAGER_PRESENT
+  IADC_clearInt(IADC0, IADC_IF_SINGLEDONE);
+  IADC_enableInt(IADC0, IADC_IEN_SINGLEDONE);
+  NVIC_ClearPendingIRQ(IADC_IRQn);
+  NVIC_EnableIRQ(IADC_IRQn);
+  IADC_command(IADC0, iadcCmdStartSingle);
+#else
+  // No conversion complete interrupt support, sample in place.
+  for (uint8_t i = 0; i < SL_POWER_SUPPLY_PROBE_SAMPLE_COUNT; i++) {
+    probe_sample_sum += get_adc_sample();
+  }
+  probe_sample_count = SL_POWER_SUPPLY_PROBE_SAMPLE_COUNT;
+  probe_samples_ready = true;
+#endif
+}
+
+static float probe_get_voltage(void)
+{
+  return (float)probe_sample_sum * ADC_SCALE_FACTOR / (float)probe_sample_count;
+}
+
+static void probe_timer_cb(sl_sleeptimer_timer_handle_t *handle, void *data)
+{
+  (void)handle;
+  (void)data;
+
+  if (probe_state == PROBE_STATE_SETTLE_UNLOADED) {
+    probe_state = PROBE_STATE_MEASURE_UNLOADED;
+    probe_start_sampling();
+  } else if (probe_state == PROBE_STATE_SETTLE_LOADED) {
+    probe_state = PROBE_STATE_MEASURE_LOADED;
+    probe_start_sampling();
+  }
+}
+
+static void probe_finish(uint8_t type, float voltage, float ir)
+{
+  supply_voltage = voltage;
+  supply_ir = ir;
+  supply_type = type;
+  probe_state = PROBE_STATE_IDLE;
+
+  if (probe_callback != NULL) {
+    probe_callback(type);
+  }
+}
+
 static uint8_t calculate_level(float voltage, batt_model_entry_t *model, uint8_t model_entry_count)
 {
   uint8_t res = 0;
@@ -304,6 +534,33 @@ static uint8_t calculate_level(float voltage, batt_model_entry_t *model, uint8_t
   return res;
 }
 
+static void batt_level_table_init(void)
+{
+  for (uint32_t i = 0; i < BATT_LEVEL_TABLE_SIZE; i++) {
+    float voltage = (float)(BATT_LEVEL_MIN_MV + i * BATT_LEVEL_STEP_MV) / 1000.0f;
+    batt_level_table[i] = calculate_level(voltage,
+                                          batt_model_cr2032,
+                                          sizeof(batt_model_cr2032) / sizeof(batt_model_entry_t));
+  }
+  batt_level_table_ready = true;
+}
+
+static uint8_t batt_level_lookup(uint32_t voltage_mv)
+{
+  if (voltage_mv <= BATT_LEVEL_MIN_MV) {
+    return batt_level_table[0];
+  }
+  if (voltage_mv >= BATT_LEVEL_MAX_MV) {
+    return batt_level_table[BATT_LEVEL_TABLE_SIZE - 1];
+  }
+  uint32_t index = (voltage_mv - BATT_LEVEL_MIN_MV) / BATT_LEVEL_STEP_MV;
+  uint32_t offset_mv = (voltage_mv - BATT_LEVEL_MIN_MV) % BATT_LEVEL_STEP_MV;
+  // The level does not decrease with the voltage, the difference is unsigned.
+  uint32_t rise = (uint32_t)(batt_level_table[index + 1] - batt_level_table[index]);
+  return (uint8_t)(batt_level_table[index]
+                   + (rise * offset_mv + BATT_LEVEL_STEP_MV / 2) / BATT_LEVEL_STEP_MV);
+}
+
 // -----------------------------------------------------------------------------
 // Public function definitions
 
@@ -324,15 +581,9 @@ void sl_power_supply_probe(void)
 
   if (sc == SL_STATUS_OK) {
     // Try to measure using 9.18 mA first.
-    v = sl_power_supply_measure_voltage(16);
+    v = sl_power_supply_measure_voltage(SL_POWER_SUPPLY_PROBE_SAMPLE_COUNT);
     r = measure_supply_ir(0x00);
-    if ( r > 5.0f ) {
-      type = SL_POWER_SUPPLY_TYPE_CR2032;
-    } else if (r > 0.5f) {
-      type = SL_POWER_SUPPLY_TYPE_AAA;
-    } else {
-      type = SL_POWER_SUPPLY_TYPE_USB;
-    }
+    type = classify_supply(r);
 
     // Store measurement results in global variables.
     supply_voltage = v;
@@ -344,6 +595,136 @@ void sl_power_supply_probe(void)
   }
 }
 
+/***************************************************************************//**
+ * Start probing the connected supply in the background.
+ ******************************************************************************/
+sl_status_t sl_power_supply_probe_start(sl_power_supply_probe_callback_t callback)
+{
+  if (probe_state != PROBE_STATE_IDLE) {
+    return SL_STATUS_IN_PROGRESS;
+  }
+
+  probe_callback = callback;
+  adc_init();
+  probe_state = PROBE_STATE_MEASURE_SUPPLY;
+  probe_start_sampling();
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Check if a background probe is in progress.
+ ******************************************************************************/
+bool sl_power_supply_is_probe_in_progress(void)
+{
+  return probe_state != PROBE_STATE_IDLE;
+}
+
+/***************************************************************************//**
+ * Advance the background probe.
+ ******************************************************************************/
+void sl_power_supply_step(void)
+{
+  sl_status_t sc;
+  float v;
+  float r;
+
+  if (!probe_samples_ready) {
+    return;
+  }
+  probe_samples_ready = false;
+  v = probe_get_voltage();
+
+  switch (probe_state) {
+    case PROBE_STATE_MEASURE_SUPPLY:
+    {
+#if SL_POWER_SUPPLY_PROBE_CACHE_ENABLE
+      probe_cache_t cache;
+      Ecode_t ec = nvm3_readData(nvm3_defaultHandle,
+                                 SL_POWER_SUPPLY_PROBE_CACHE_NVM3_KEY,
+                                 &cache,
+                                 sizeof(cache));
+      // A matching cached supply skips the internal resistance measurement.
+      if ((ec == ECODE_NVM3_OK)
+          && (cache.type != SL_POWER_SUPPLY_TYPE_UNKNOWN)) {
+        float dv = (v > cache.voltage) ? (v - cache.voltage) : (cache.voltage - v);
+        if (dv * 1000.0f <= (float)SL_POWER_SUPPLY_PROBE_CACHE_TOLERANCE_MV) {
+          power_supply_log_info("Power supply - sv = %.3f, cached type %d" POWER_SUPPLY_LOG_NEW_LINE,
+                                (double)v, cache.type);
+          probe_finish(cache.type, v, cache.ir);
+          break;
+        }
+      }
+#endif // SL_POWER_SUPPLY_PROBE_CACHE_ENABLE
+      supply_voltage = v;
+      // The Si7021 is only needed for the internal resistance measurement,
+      // give it the settling time to power up.
+      sc = sl_board_enable_sensor(SL_BOARD_SENSOR_RHT);
+      app_assert((SL_STATUS_OK == sc),
+                 "[E: %#04lx] Si7021 sensor not available" POWER_SUPPLY_LOG_NEW_LINE,
+                 sc);
+      probe_state = PROBE_STATE_SETTLE_UNLOADED;
+      sc = sl_sleeptimer_start_timer_ms(&probe_timer,
+                                        SL_POWER_SUPPLY_PROBE_SETTLE_MS,
+                                        probe_timer_cb,
+                                        NULL,
+                                        0,
+                                        0);
+      app_assert_status(sc);
+      break;
+    }
+
+    case PROBE_STATE_MEASURE_UNLOADED:
+      sc = sl_si70xx_init(sl_i2cspm_sensor, SI7021_ADDR);
+      if (sc != SL_STATUS_OK) {
+        power_supply_log_warning("Si7021 sensor initialization failed. "
+                                 "Unable to detect power supply type." POWER_SUPPLY_LOG_NEW_LINE);
+        probe_finish(SL_POWER_SUPPLY_TYPE_UNKNOWN, supply_voltage, 0.0f);
+        break;
+      }
+      probe_voltage_unloaded = v;
+      // Enable heater in Si7021 - 9.81 mA
+      heater_set(true, 0x00);
+      probe_state = PROBE_STATE_SETTLE_LOADED;
+      sc = sl_sleeptimer_start_timer_ms(&probe_timer,
+                                        SL_POWER_SUPPLY_PROBE_SETTLE_MS,
+                                        probe_timer_cb,
+                                        NULL,
+                                        0,
+                                        0);
+      app_assert_status(sc);
+      break;
+
+    case PROBE_STATE_MEASURE_LOADED:
+    {
+      float i = heater_current(0x00);
+
+      heater_set(false, 0x00);
+      r = (probe_voltage_unloaded - v) / i;
+      power_supply_log_info("Power supply - sv = %.3f   svl = %.3f   i = %.3f   r = %.3f" POWER_SUPPLY_LOG_NEW_LINE,
+                            (double)probe_voltage_unloaded, (double)v, (double)i, (double)r);
+#if SL_POWER_SUPPLY_PROBE_CACHE_ENABLE
+      probe_cache_t cache = {
+        .voltage = supply_voltage,
+        .ir = r,
+        .type = classify_supply(r)
+      };
+      if (nvm3_writeData(nvm3_defaultHandle,
+                         SL_POWER_SUPPLY_PROBE_CACHE_NVM3_KEY,
+                         &cache,
+                         sizeof(cache)) != ECODE_NVM3_OK) {
+        power_supply_log_warning("Failed to cache power supply type" POWER_SUPPLY_LOG_NEW_LINE);
+      }
+#endif // SL_POWER_SUPPLY_PROBE_CACHE_ENABLE
+      probe_finish(classify_supply(r), supply_voltage, r);
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
 /***************************************************************************//**
  * Retrieve the supply characteristic variables.
  ******************************************************************************/
@@ -398,8 +779,89 @@ float sl_power_supply_measure_voltage(unsigned int avg)
  ******************************************************************************/
 uint8_t sl_power_supply_get_battery_level(void)
 {
-  float voltage = sl_power_supply_measure_voltage(1);
-  uint8_t level = calculate_level(voltage, batt_model_cr2032, sizeof(batt_model_cr2032) / sizeof(batt_model_entry_t));
+  uint32_t sample_mv;
+  uint32_t filter_mv;
+  uint8_t level;
+
+  if (!batt_level_table_ready) {
+    batt_level_table_init();
+  }
 
-  return level;
+  // The IADC is owned by the background probe until it is finished. Before
+  // the first reading, report the level of the last probed supply voltage.
+  if (probe_state != PROBE_STATE_IDLE) {
+#if SL_POWER_SUPPLY_PROBE_CACHE_ENABLE
+    if (batt_level == SL_POWER_SUPPLY_BATTERY_LEVEL_UNKNOWN) {
+      probe_cache_t cache;
+      if (nvm3_readData(nvm3_defaultHandle,
+                        SL_POWER_SUPPLY_PROBE_CACHE_NVM3_KEY,
+                        &cache,
+                        sizeof(cache)) == ECODE_NVM3_OK) {
+        batt_level = batt_level_lookup((uint32_t)(cache.voltage * 1000.0f + 0.5f));
+      }
+    }
+#endif // SL_POWER_SUPPLY_PROBE_CACHE_ENABLE
+    return batt_level;
+  }
+
+  adc_init();
+  sample_mv = ((uint32_t)get_adc_sample() * ADC_FULL_SCALE_MV + ADC_MAX_CODE / 2) / ADC_MAX_CODE;
+
+  if (batt_filter_mv == 0) {
+    // First reading seeds the filter.
+    batt_filter_mv = sample_mv << BATT_FILTER_SHIFT;
+    batt_level = batt_level_lookup(sample_mv);
+    return batt_level;
+  }
+
+  // Exponential moving average, weight of the new sample 1 / 2^SMOOTHING.
+  batt_filter_mv = batt_filter_mv
+                   - (batt_filter_mv >> SL_POWER_SUPPLY_BATTERY_SMOOTHING)
+                   + ((sample_mv << BATT_FILTER_SHIFT) >> SL_POWER_SUPPLY_BATTERY_SMOOTHING);
+  filter_mv = batt_filter_mv >> BATT_FILTER_SHIFT;
+  level = batt_level_lookup(filter_mv);
+
+  // A rise beyond the hysteresis (e.g. a new battery) is reported at once.
+  // Other changes must hold for the dwell count, so the voltage sagging under
+  // radio load is neither reported nor kept once the battery recovers.
+  if (level >= batt_level + SL_POWER_SUPPLY_BATTERY_LEVEL_HYSTERESIS) {
+    batt_level = level;
+    batt_level_dwell = 0;
+  } else if (level == batt_level) {
+    batt_level_dwell = 0;
+  } else {
+    if ((level < batt_level) != batt_level_falling) {
+      batt_level_falling = (level < batt_level);
+      batt_level_dwell = 0;
+    }
+    if (++batt_level_dwell >= SL_POWER_SUPPLY_BATTERY_LEVEL_DWELL) {
+      batt_level = level;
+      batt_level_dwell = 0;
+    }
+  }
+
+  return batt_level;
+}
+
+#if defined(IADC_PRESENT)
+/***************************************************************************//**
+ * IADC interrupt handler collecting the samples of the background probe.
+ ******************************************************************************/
+void IADC_IRQHandler(void)
+{
+  IADC_clearInt(IADC0, IADC_IF_SINGLEDONE);
+  probe_sample_sum += IADC_readSingleData(IADC0);
+  probe_sample_count++;
+
+  if (probe_sample_count < SL_POWER_SUPPLY_PROBE_SAMPLE_COUNT) {
+    IADC_command(IADC0, iadcCmdStartSingle);
+  } else {
+    IADC_disableInt(IADC0, IADC_IEN_SINGLEDONE);
+    NVIC_DisableIRQ(IADC_IRQn);
+#ifdef SL_CATALOG_POWER_MANAGER_PRESENT
+    sl_power_manager_remove_em_requirement(SL_POWER_MANAGER_EM1);
+#endif // SL_CATALOG_POWER_MANAGER_PRESENT
+    probe_samples_ready = true;
+  }
 }
+#endif // IADC_PRESENT
@@ -38,6 +38,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "sl_status.h"
 
 #define SL_POWER_SUPPLY_TYPE_UNKNOWN 0 ///< Unknown power supply type
 #define SL_POWER_SUPPLY_TYPE_USB     1 ///< The board powered from the USB connector
@@ -45,6 +46,15 @@
 #define SL_POWER_SUPPLY_TYPE_AAA     3 ///< The board powered from AAA batteries
 #define SL_POWER_SUPPLY_TYPE_CR2032  4 ///< The board powered from a CR2032 battery
 
+#define SL_POWER_SUPPLY_BATTERY_LEVEL_UNKNOWN 0xFF ///< Battery level not measured yet
+
+/***************************************************************************//**
+ * Callback invoked when a background probe is finished.
+ *
+ * @param[in] type Detected power supply type.
+ ******************************************************************************/
+typedef void (*sl_power_supply_probe_callback_t)(uint8_t type);
+
 /***************************************************************************//**
  * Probe the connected supply and determine its type.
  *
@@ -52,6 +62,36 @@
  ******************************************************************************/
 void sl_power_supply_probe(void);
 
+/***************************************************************************//**
+ * Start probing the connected supply in the background.
+ *
+ * The supply voltage is sampled in the IADC interrupt and the settling times
+ * are timed by the sleeptimer, so the caller is not blocked. The probe is
+ * advanced by \ref sl_power_supply_step. If the supply voltage matches the
+ * result of the previous probe stored in NVM3, the internal resistance
+ * measurement is skipped.
+ *
+ * @param[in] callback Function called when the probe is finished, can be NULL.
+ * @return SL_STATUS_OK if the probe was started, SL_STATUS_IN_PROGRESS if a
+ *         probe is already running.
+ *
+ * @note The results can be acquired with \ref sl_power_supply_get_characteristics.
+ ******************************************************************************/
+sl_status_t sl_power_supply_probe_start(sl_power_supply_probe_callback_t callback);
+
+/***************************************************************************//**
+ * Check if a background probe is in progress.
+ *
+ * @return True if a probe started by \ref sl_power_supply_probe_start is
+ *         not finished yet.
+ ******************************************************************************/
+bool sl_power_supply_is_probe_in_progress(void);
+
+/***************************************************************************//**
+ * Advance the background probe, called from the main loop.
+ ******************************************************************************/
+void sl_power_supply_step(void);
+
 /***************************************************************************//**
  * Retrieve the supply characteristic variables.
  *
@@ -86,7 +126,11 @@ float sl_power_supply_measure_voltage(unsigned int avg);
 /***************************************************************************//**
  * Measure the battery level.
  *
- * @return The estimated battery capacity level in percent.
+ * While the first background probe owns the A/D converter, the level of the
+ * supply voltage cached in NVM3 is returned, if any.
+ *
+ * @return The estimated battery capacity level in percent, or
+ *         SL_POWER_SUPPLY_BATTERY_LEVEL_UNKNOWN before the first measurement.
  ******************************************************************************/
 uint8_t sl_power_supply_get_battery_level(void);
 
@@ -33,7 +33,7 @@
 #include "em_usart.h"
 #include "sl_gpio.h"
 #include "sl_clock_manager.h"
-#include "sl_sleeptimer.h"
+#include "sl_udelay.h"
 #include "sl_icm20648.h"
 #include "sl_icm20648_config.h"
 
@@ -79,7 +79,7 @@ sl_status_t sl_icm20648_init(void)
   sl_icm20648_write_register(ICM20648_REG_PWR_MGMT_1, ICM20648_BIT_CLK_PLL);
 
   /* PLL startup time - maybe it is too long but better be on the safe side, no spec in the datasheet */
-  sl_sleeptimer_delay_millisecond(30);
+  sl_udelay_sleep(30000);
 
   /* INT pin: active low, open drain, IT status read clears. It seems that latched mode does not work, the INT pin cannot be cleared if set */
   sl_icm20648_write_register(ICM20648_REG_INT_PIN_CFG, ICM20648_BIT_INT_ACTL | ICM20648_BIT_INT_OPEN);
@@ -105,7 +105,7 @@ sl_status_t sl_icm20648_reset(void)
   sl_icm20648_write_register(ICM20648_REG_PWR_MGMT_1, ICM20648_BIT_H_RESET);
 
   /* Wait 100ms to complete the reset sequence */
-  sl_sleeptimer_delay_millisecond(100);
+  sl_udelay_sleep(100000);
 
   return SL_STATUS_OK;
 }
@@ -468,7 +468,7 @@ sl_status_t sl_icm20648_enter_low_power_mode(bool enAccel, bool enGyro, bool enT
 
     /* Enable the accelerometer and the gyroscope*/
     sl_icm20648_enable_sensor(enAccel, enGyro, enTemp);
-    sl_sleeptimer_delay_millisecond(50);
+    sl_udelay_sleep(50000);
 
     /* Enable cycle mode */
     sl_icm20648_enable_cycle_mode(true);
@@ -579,7 +579,7 @@ sl_status_t sl_icm20648_enable_wake_on_motion_interrupt(bool enable, uint8_t wom
 
     /* Enable the Wake On Motion interrupt */
     sl_icm20648_enable_interrupt(false, true);
-    sl_sleeptimer_delay_millisecond(50);
+    sl_udelay_sleep(50000);
 
     /* Enable Wake On Motion feature */
     sl_icm20648_write_register(ICM20648_REG_ACCEL_INTEL_CTRL, ICM20648_BIT_ACCEL_INTEL_EN | ICM20648_BIT_ACCEL_INTEL_MODE);
@@ -641,7 +641,7 @@ sl_status_t sl_icm20648_calibrate_accel_and_gyro(float *accelBiasScaled, float *
 
   /* The accel sensor needs max 30ms, the gyro max 35ms to fully start */
   /* Experiments show that the gyro needs more time to get reliable results */
-  sl_sleeptimer_delay_millisecond(50);
+  sl_udelay_sleep(50000);
 
   /* Disable the FIFO */
   sl_icm20648_write_register(ICM20648_REG_USER_CTRL, ICM20648_BIT_FIFO_EN);
@@ -662,7 +662,7 @@ sl_status_t sl_icm20648_calibrate_accel_and_gyro(float *accelBiasScaled, float *
   /* Loop until at least 4080 samples gathered */
   fifoCount = 0;
   while ( fifoCount < 4080 ) {
-    sl_sleeptimer_delay_millisecond(5);
+    sl_udelay_sleep(5000);
     /* Read FIFO sample count */
     sl_icm20648_read_register(ICM20648_REG_FIFO_COUNT_H, 2, &data[0]);
     /* Convert to a 16 bit value */
@@ -837,7 +837,7 @@ sl_status_t sl_icm20648_calibrate_gyro(float *gyroBiasScaled)
 
   /* The accel sensor needs max 30ms, the gyro max 35ms to fully start */
   /* Experiments show that the gyro needs more time to get reliable results */
-  sl_sleeptimer_delay_millisecond(50);
+  sl_udelay_sleep(50000);
 
   /* Disable the FIFO */
   sl_icm20648_write_register(ICM20648_REG_USER_CTRL, ICM20648_BIT_FIFO_EN);
@@ -858,7 +858,7 @@ sl_status_t sl_icm20648_calibrate_gyro(float *gyroBiasScaled)
   /* Loop until at least 4080 samples gathered */
   fifoCount = 0;
   while ( fifoCount < 4080 ) {
-    sl_sleeptimer_delay_millisecond(5);
+    sl_udelay_sleep(5000);
 
     /* Read FIFO sample count */
     sl_icm20648_read_register(ICM20648_REG_FIFO_COUNT_H, 2, &data[0]);
@@ -33,7 +33,7 @@
 
 #include "sl_icm20648.h"
 #include "sl_imu.h"
-#include "sl_sleeptimer.h"
+#include "sl_udelay.h"
 
 /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
 static uint8_t IMU_state = IMU_STATE_DISABLED; /**< IMU state variable                                  */
@@ -135,7 +135,7 @@ void sl_imu_configure(float sampleRate)
   /* Gyro: 250 degrees per sec full scale */
   sl_icm20648_gyro_set_full_scale(ICM20648_GYRO_FULLSCALE_250DPS);
 
-  sl_sleeptimer_delay_millisecond(50);
+  sl_udelay_sleep(50000);
 
   /* Enable the raw data ready interrupt */
   sl_icm20648_enable_interrupt(true, false);
@@ -125,7 +125,7 @@ void sl_mx25_flash_shutdown(void)
 #endif
 
   // Wait for flash warm-up
-  sl_udelay_wait(800);               // wait for tVSL=800us
+  sl_udelay_sleep(800);              // wait for tVSL=800us
 
   // Wake up flash in case the device is in deep power down mode already.
   cs_low();
@@ -30,7 +30,7 @@
 
 #include <stdint.h>
 #include "sl_i2cspm.h"
-#include "sl_sleeptimer.h"
+#include "sl_udelay.h"
 #include "sl_si1133.h"
 
 /***************************************************************************//**
@@ -133,7 +133,7 @@ sl_status_t sl_si1133_init(sl_i2cspm_t *i2cspm)
   sl_status_t retval;
 
   /* Do not access the Si1133 earlier than 25 ms from power-up */
-  sl_sleeptimer_delay_millisecond(50);
+  sl_udelay_sleep(50000);
 
   /* Reset the sensor. The reset function implements the necessary delays after reset. */
   retval = sl_si1133_reset(i2cspm);
@@ -194,12 +194,12 @@ sl_status_t sl_si1133_measure_lux_uvi(sl_i2cspm_t *i2cspm, float *lux, float *uv
   retval = sl_si1133_force_measurement(i2cspm);
 
   /* Wait while the sensor does the conversion */
-  sl_sleeptimer_delay_millisecond(200);
+  sl_udelay_sleep(200000);
 
   /* Check if the measurement finished, if not then wait */
   retval += sl_si1133_read_register(i2cspm, SI1133_REG_IRQ_STATUS, &response);
   while ( response != 0x0F ) {
-    sl_sleeptimer_delay_millisecond(5);
+    sl_udelay_sleep(5000);
     retval += sl_si1133_read_register(i2cspm, SI1133_REG_IRQ_STATUS, &response);
   }
 
@@ -390,7 +390,7 @@ sl_status_t sl_si1133_reset(sl_i2cspm_t *i2cspm)
 
   /* Allow a minimum of 25ms for Si1133 sensor to perform initial       */
   /* startup sequence                                                   */
-  sl_sleeptimer_delay_millisecond(30);
+  sl_udelay_sleep(30000);
 
   return retval;
 }
@@ -32,7 +32,7 @@
 #include <stddef.h>
 #include "sl_si70xx.h"
 #include "sl_i2cspm.h"
-#include "sl_sleeptimer.h"
+#include "sl_udelay.h"
 #include "stddef.h"
 
 /*******************************************************************************
@@ -81,7 +81,7 @@ sl_status_t sl_si70xx_init(sl_i2cspm_t *i2cspm, uint8_t addr)
 
   if (!sl_si70xx_present(i2cspm, addr, NULL)) {
     /* Wait for sensor to become ready */
-    sl_sleeptimer_delay_millisecond(80);
+    sl_udelay_sleep(80000);
 
     if (!sl_si70xx_present(i2cspm, addr, NULL)) {
       status = SL_STATUS_INITIALIZATION;
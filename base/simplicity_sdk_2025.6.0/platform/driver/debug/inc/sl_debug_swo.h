@@ -31,6 +31,8 @@
 #define SL_DEBUG_SWO_H
 
 #include "sl_status.h"
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -152,6 +154,57 @@ sl_status_t sl_debug_swo_write_u16(uint32_t channel, uint16_t half_word);
  */
 sl_status_t sl_debug_swo_write_u32(uint32_t channel, uint32_t word);
 
+/**
+ * Queue data for an ITM channel
+ *
+ * @details
+ * Copies the data to a RAM buffer of SL_DEBUG_SWO_BUFFER_SIZE bytes, which is
+ * written to the ITM by @ref sl_debug_swo_process_action. This function never
+ * waits for the ITM, and can be called from interrupt context.
+ *
+ * @param[in] channel ITM channel number
+ * @param[in] data Data to send
+ * @param[in] length Number of bytes to send
+ *
+ * @return Status code
+ * @retval SL_STATUS_OK Data queued successfully
+ * @retval SL_STATUS_FULL Not enough space in the buffer, the data was dropped
+ *                        and counted in @ref sl_debug_swo_get_dropped_count
+ * @retval SL_STATUS_NOT_INITIALIZED ITM has not been enabled, call
+ *                                   @ref sl_debug_swo_init first.
+ * @retval SL_STATUS_NOT_SUPPORTED The buffer is disabled
+ */
+sl_status_t sl_debug_swo_write_buffered(uint32_t channel, const void *data, size_t length);
+
+/**
+ * Write queued data to the ITM
+ *
+ * @details
+ * Writes the data queued by @ref sl_debug_swo_write_buffered for as long as
+ * the ITM stimulus port accepts it, and returns as soon as the port is busy.
+ * Like the blocking writes, it enables the stimulus port of the channel
+ * before writing to it. Queued data is discarded, and counted as dropped,
+ * while the ITM is disabled. To be called from the application main loop.
+ */
+void sl_debug_swo_process_action(void);
+
+/**
+ * Get the number of bytes dropped because the buffer was full or the ITM
+ * was disabled
+ *
+ * @return Number of dropped bytes since initialization
+ */
+uint32_t sl_debug_swo_get_dropped_count(void);
+
+/**
+ * Check if the MCU can sleep, which is not the case while queued data is
+ * waiting for the ITM, as the SWO does not run in EM2. To be called from
+ * the application's app_is_ok_to_sleep() hook.
+ *
+ * @return True, if there is no queued data, or the ITM is disabled.
+ */
+bool sl_debug_swo_is_ok_to_sleep(void);
+
 /**
  * alias for backward compatibility
  */
@@ -41,9 +41,35 @@
 #include "sl_gpio.h"
 
 #include "sl_clock_manager.h"
+#include "sl_core.h"
 #include "sl_debug_swo_config.h"
 #include "sl_component_catalog.h"
 
+#ifndef SL_DEBUG_SWO_BUFFER_SIZE
+#define SL_DEBUG_SWO_BUFFER_SIZE  0
+#endif
+
+#if (SL_DEBUG_SWO_BUFFER_SIZE & (SL_DEBUG_SWO_BUFFER_SIZE - 1)) || (SL_DEBUG_SWO_BUFFER_SIZE > 32768)
+#error SL_DEBUG_SWO_BUFFER_SIZE must be 0 or a power of 2 not larger than 32768.
+#endif
+
+#if SL_DEBUG_SWO_BUFFER_SIZE > 0
+// Each queued write is a record of a channel byte, a length byte and the data
+#define SWO_RECORD_HEADER_SIZE  2
+#define SWO_RECORD_DATA_MAX     255
+#define SWO_BUFFER_INDEX(i)     ((i) & (SL_DEBUG_SWO_BUFFER_SIZE - 1))
+
+static uint8_t swo_buffer[SL_DEBUG_SWO_BUFFER_SIZE];
+// Free running indexes, the head is moved by writers in a critical section,
+// the tail only by sl_debug_swo_process_action()
+static volatile uint16_t swo_buffer_head = 0;
+static volatile uint16_t swo_buffer_tail = 0;
+static volatile uint32_t swo_buffer_dropped = 0;
+// Record being written to the ITM
+static uint8_t swo_drain_channel = 0;
+static uint8_t swo_drain_remaining = 0;
+#endif
+
 sl_status_t sl_debug_swo_init(void)
 {
   sl_status_t status;
@@ -207,6 +233,147 @@ sl_status_t sl_debug_swo_write_u32(uint32_t channel, uint32_t word)
   return SL_STATUS_NOT_INITIALIZED;
 }
 
+#if SL_DEBUG_SWO_BUFFER_SIZE > 0
+
+sl_status_t sl_debug_swo_write_buffered(uint32_t channel, const void *data, size_t length)
+{
+  CORE_DECLARE_IRQ_STATE;
+  const uint8_t *bytes = (const uint8_t *)data;
+  uint8_t chunk;
+  uint16_t head;
+
+  if ((ITM->TCR & ITM_TCR_ITMENA_Msk) == 0) {
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+
+  while (length > 0) {
+    chunk = (length > SWO_RECORD_DATA_MAX) ? SWO_RECORD_DATA_MAX : (uint8_t)length;
+
+    CORE_ENTER_ATOMIC();
+    head = swo_buffer_head;
+    if ((uint16_t)(SL_DEBUG_SWO_BUFFER_SIZE - (uint16_t)(head - swo_buffer_tail))
+        < (SWO_RECORD_HEADER_SIZE + chunk)) {
+      swo_buffer_dropped += length;
+      CORE_EXIT_ATOMIC();
+      return SL_STATUS_FULL;
+    }
+    swo_buffer[SWO_BUFFER_INDEX(head++)] = (uint8_t)channel;
+    swo_buffer[SWO_BUFFER_INDEX(head++)] = chunk;
+    for (uint8_t i = 0; i < chunk; i++) {
+      swo_buffer[SWO_BUFFER_INDEX(head++)] = bytes[i];
+    }
+    swo_buffer_head = head;
+    CORE_EXIT_ATOMIC();
+
+    bytes += chunk;
+    length -= chunk;
+  }
+
+  return SL_STATUS_OK;
+}
+
+// Drop the queued data, nothing drains it while the ITM is disabled. Only
+// data bytes are counted, not the record headers.
+static void swo_buffer_discard(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+  uint16_t tail;
+  uint32_t dropped;
+
+  CORE_ENTER_ATOMIC();
+  tail = (uint16_t)(swo_buffer_tail + swo_drain_remaining);
+  dropped = swo_drain_remaining;
+  while (tail != swo_buffer_head) {
+    dropped += swo_buffer[SWO_BUFFER_INDEX(tail + 1)];
+    tail += SWO_RECORD_HEADER_SIZE + swo_buffer[SWO_BUFFER_INDEX(tail + 1)];
+  }
+  swo_buffer_dropped += dropped;
+  swo_buffer_tail = swo_buffer_head;
+  swo_drain_remaining = 0;
+  CORE_EXIT_ATOMIC();
+}
+
+void sl_debug_swo_process_action(void)
+{
+  uint16_t tail = swo_buffer_tail;
+  uint32_t word;
+
+  if (tail == swo_buffer_head) {
+    return;
+  }
+  if ((ITM->TCR & ITM_TCR_ITMENA_Msk) == 0) {
+    swo_buffer_discard();
+    return;
+  }
+
+  while (tail != swo_buffer_head) {
+    if (swo_drain_remaining == 0) {
+      swo_drain_channel = swo_buffer[SWO_BUFFER_INDEX(tail++)];
+      swo_drain_remaining = swo_buffer[SWO_BUFFER_INDEX(tail++)];
+      continue;
+    }
+    // Same JLink workaround as the blocking writes
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    ITM->TER |= (1UL << swo_drain_channel);
+    if (ITM->PORT[swo_drain_channel].u32 == 0) {
+      // Stimulus port busy, continue on the next call
+      break;
+    }
+    // Word writes take 5 bytes on the wire for 4 bytes of data, byte writes 2
+    if (swo_drain_remaining >= 4) {
+      word = swo_buffer[SWO_BUFFER_INDEX(tail)]
+             | ((uint32_t)swo_buffer[SWO_BUFFER_INDEX(tail + 1)] << 8)
+             | ((uint32_t)swo_buffer[SWO_BUFFER_INDEX(tail + 2)] << 16)
+             | ((uint32_t)swo_buffer[SWO_BUFFER_INDEX(tail + 3)] << 24);
+      ITM->PORT[swo_drain_channel].u32 = word;
+      tail += 4;
+      swo_drain_remaining -= 4;
+    } else {
+      ITM->PORT[swo_drain_channel].u8 = swo_buffer[SWO_BUFFER_INDEX(tail)];
+      tail++;
+      swo_drain_remaining--;
+    }
+  }
+  swo_buffer_tail = tail;
+}
+
+uint32_t sl_debug_swo_get_dropped_count(void)
+{
+  return swo_buffer_dropped;
+}
+
+bool sl_debug_swo_is_ok_to_sleep(void)
+{
+  return (swo_buffer_tail == swo_buffer_head)
+         || ((ITM->TCR & ITM_TCR_ITMENA_Msk) == 0);
+}
+
+#else // SL_DEBUG_SWO_BUFFER_SIZE
+
+sl_status_t sl_debug_swo_write_buffered(uint32_t channel, const void *data, size_t length)
+{
+  (void) channel;
+  (void) data;
+  (void) length;
+  return SL_STATUS_NOT_SUPPORTED;
+}
+
+void sl_debug_swo_process_action(void)
+{
+}
+
+uint32_t sl_debug_swo_get_dropped_count(void)
+{
+  return 0;
+}
+
+bool sl_debug_swo_is_ok_to_sleep(void)
+{
+  return true;
+}
+
+#endif // SL_DEBUG_SWO_BUFFER_SIZE
+
 #else // __CORTEX_M
 
 sl_status_t sl_debug_swo_init(void)
@@ -247,4 +414,26 @@ sl_status_t sl_debug_swo_write_u32(uint32_t channel, uint32_t word)
   return SL_STATUS_NOT_SUPPORTED;
 }
 
+sl_status_t sl_debug_swo_write_buffered(uint32_t channel, const void *data, size_t length)
+{
+  (void) channel;
+  (void) data;
+  (void) length;
+  return SL_STATUS_NOT_SUPPORTED;
+}
+
+void sl_debug_swo_process_action(void)
+{
+}
+
+uint32_t sl_debug_swo_get_dropped_count(void)
+{
+  return 0;
+}
+
+bool sl_debug_swo_is_ok_to_sleep(void)
+{
+  return true;
+}
+
 #endif // __CORTEX_M
@@ -38,6 +38,8 @@
 #include "sl_status.h"
 #include "ecode.h"
 #include "nvm3_hal.h"
+#include "nvm3_config.h"
+#include "nvm3_telemetry_config.h"
 
 #if defined(NVM3_SECURITY)
 #include "nvm3_hal_crypto.h"
@@ -205,6 +207,31 @@ typedef struct {
   size_t additionalCacheNeeded;                   ///< Additional cache size needed to accommodate all objects
 } nvm3_MemInfo_t;
 
+#if NVM3_TELEMETRY
+/// @brief Key ranges that the telemetry write statistics are split into, see
+///        the key map of nvm3_telemetry_config.h.
+typedef enum {
+  NVM3_TELEMETRY_KEY_RANGE_USER = 0,              ///< Application keys
+  NVM3_TELEMETRY_KEY_RANGE_BLUETOOTH,             ///< Bluetooth stack keys
+  NVM3_TELEMETRY_KEY_RANGE_PSA_ITS,               ///< PSA internal trusted storage keys
+  NVM3_TELEMETRY_KEY_RANGE_OTHER,                 ///< All other keys
+  NVM3_TELEMETRY_KEY_RANGE_COUNT                  ///< Number of key ranges
+} nvm3_TelemetryKeyRange_t;
+
+/// @brief NVM3 repack and write statistics, counted since the instance was opened.
+typedef struct {
+  uint32_t userRepackCount;                       ///< Page repack steps run by nvm3_repack()
+  uint32_t forcedRepackCount;                     ///< Page repack steps run by NVM3 itself before a write, at open or on resize
+  uint32_t pageEraseCount;                        ///< Pages erased by repacks
+  uint32_t repackBytesCopied;                     ///< Object bytes, headers included, copied by repacks
+  uint32_t repackMaxBytesCopied;                  ///< Most object bytes copied by a single repack step
+  uint32_t repackTicks;                           ///< Time spent in repack steps, in sleeptimer ticks
+  uint32_t repackMaxTicks;                        ///< Longest repack step, in sleeptimer ticks
+  uint32_t writeCount[NVM3_TELEMETRY_KEY_RANGE_COUNT]; ///< Objects written or deleted, per key range
+  uint32_t writeBytes[NVM3_TELEMETRY_KEY_RANGE_COUNT]; ///< Object data bytes written, per key range
+} nvm3_Telemetry_t;
+#endif
+
 /// @brief NVM3 callback parameters.
 typedef struct {
   size_t lowMemoryThreshold;                      ///< Low memory threshold to be set by the user
@@ -247,6 +274,9 @@ typedef struct {
   const nvm3_HalCryptoHandle_t *halCryptoHandle;  // HAL crypto handle
   nvm3_SecurityType_t secType;                    // Security type
 #endif
+#if NVM3_TELEMETRY
+  nvm3_Telemetry_t telemetry;                     // Repack and write statistics
+#endif
 } nvm3_Handle_t;
 
 /// @endcond
@@ -765,6 +795,52 @@ sl_status_t nvm3_deregisterCallback(nvm3_Handle_t *h);
  ******************************************************************************/
 sl_status_t nvm3_getMemInfo(nvm3_Handle_t *h, nvm3_MemInfo_t *memInfo);
 
+#if NVM3_TELEMETRY
+/***************************************************************************//**
+ * @brief
+ *  Retrieves the repack and write statistics of the NVM3 instance.
+ *  The statistics are cleared when the instance is opened and are not kept
+ *  across resets.
+ *
+ * @param[in] h
+ *  A pointer to the NVM3 driver handle.
+ *
+ * @param[out] telemetry
+ *  A pointer to a structure where the statistics will be stored.
+ *
+ * @return
+ *  - @ref SL_STATUS_OK if the operation is successful.
+ *  - @ref SL_STATUS_INVALID_PARAMETER if the handle or `telemetry` is NULL.
+ *  - @ref SL_STATUS_NOT_INITIALIZED if the NVM3 instance is not initialized.
+ ******************************************************************************/
+sl_status_t nvm3_getTelemetry(nvm3_Handle_t *h, nvm3_Telemetry_t *telemetry);
+
+/***************************************************************************//**
+ * @brief
+ *  Retrieves the erase count of every page in the NVM3 instance.
+ *  Unlike @ref nvm3_getEraseCount, which only reports the first page of the
+ *  FIFO, this reads every page header and so shows how wear is spread. Pages
+ *  that are not in a good state report a count derived from the previous
+ *  good page.
+ *
+ * @param[in] h
+ *  A pointer to the NVM3 driver handle.
+ *
+ * @param[out] eraseCnt
+ *  A pointer to an array receiving one erase count per page, in address order.
+ *
+ * @param[in,out] count
+ *  On input, the number of elements in `eraseCnt`. On output, the number of
+ *  pages reported, which is at most the number of pages in the instance.
+ *
+ * @return
+ *  - @ref SL_STATUS_OK if the operation is successful.
+ *  - @ref SL_STATUS_INVALID_PARAMETER if a pointer is NULL.
+ *  - @ref SL_STATUS_NOT_INITIALIZED if the NVM3 instance is not initialized.
+ ******************************************************************************/
+sl_status_t nvm3_getPageEraseCounts(nvm3_Handle_t *h, uint32_t *eraseCnt, size_t *count);
+#endif
+
 /** @} (end addtogroup nvm3) */
 
 #ifdef __cplusplus
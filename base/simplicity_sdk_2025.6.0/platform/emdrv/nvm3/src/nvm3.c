@@ -41,6 +41,13 @@
 #include "nvm3_utils.h"
 #include "nvm3_config.h"
 
+#if NVM3_TELEMETRY && defined(SL_COMPONENT_CATALOG_PRESENT)
+#include "sl_component_catalog.h"
+#endif
+#if NVM3_TELEMETRY && defined(SL_CATALOG_SLEEPTIMER_PRESENT)
+#include "sl_sleeptimer.h"
+#endif
+
 /// @cond DO_NOT_INCLUDE_WITH_DOXYGEN
 
 //****************************************************************************
@@ -331,6 +338,42 @@ __STATIC_INLINE size_t pageIdxDecrement(nvm3_Handle_t *h, size_t idx)
   return (idx > 0U) ? (idx - 1U) : (h->totalNvmPageCnt - 1U);
 }
 
+#if NVM3_TELEMETRY
+__STATIC_INLINE uint32_t telemetryTicks(void)
+{
+#if defined(SL_CATALOG_SLEEPTIMER_PRESENT)
+  return sl_sleeptimer_get_tick_count();
+#else
+  return 0U;
+#endif
+}
+
+// A function, so a range of the key map starting at key 0 is no always true
+// comparison.
+__STATIC_INLINE bool telemetryKeyInRange(nvm3_ObjectKey_t key, nvm3_ObjectKey_t min, nvm3_ObjectKey_t max)
+{
+  return (key >= min) && (key <= max);
+}
+
+// Account an object write to the key range of the key map it belongs to.
+static void telemetryWrite(nvm3_Handle_t *h, nvm3_ObjectKey_t key, size_t len)
+{
+  nvm3_TelemetryKeyRange_t range;
+
+  if (telemetryKeyInRange(key, NVM3_TELEMETRY_KEY_USER_MIN, NVM3_TELEMETRY_KEY_USER_MAX)) {
+    range = NVM3_TELEMETRY_KEY_RANGE_USER;
+  } else if (telemetryKeyInRange(key, NVM3_TELEMETRY_KEY_BLUETOOTH_MIN, NVM3_TELEMETRY_KEY_BLUETOOTH_MAX)) {
+    range = NVM3_TELEMETRY_KEY_RANGE_BLUETOOTH;
+  } else if (telemetryKeyInRange(key, NVM3_TELEMETRY_KEY_PSA_ITS_MIN, NVM3_TELEMETRY_KEY_PSA_ITS_MAX)) {
+    range = NVM3_TELEMETRY_KEY_RANGE_PSA_ITS;
+  } else {
+    range = NVM3_TELEMETRY_KEY_RANGE_OTHER;
+  }
+  h->telemetry.writeCount[range]++;
+  h->telemetry.writeBytes[range] += (uint32_t)len;
+}
+#endif
+
 #if defined(NVM3_SECURITY)
 /******************************************************************************************************//**
  * Get the security type from a valid page.
@@ -1396,6 +1439,11 @@ static sl_status_t fifoWriteWrapper(nvm3_Handle_t *h, nvm3_ObjectKey_t key,
   /* Write the object to NVM. */
   sta = fifoWriteObj(h, pObjB, COPY_OBJ_FALSE, objGroup);
   objEnd(pObjB);
+#if NVM3_TELEMETRY
+  if (sta == SL_STATUS_OK) {
+    telemetryWrite(h, key, srcLen);
+  }
+#endif
 
   // Check if a low memory callback is registered
   if (h->lowMemCallback != NULL) {
@@ -2340,6 +2388,12 @@ static sl_status_t repackFirstPage(nvm3_Handle_t *h, repackCopyMode_t copyMode)
       fifoScan(h, fifoScanFirst, repackFirstPageCallback, &parameters);
     }
   }
+#if NVM3_TELEMETRY
+  h->telemetry.repackBytesCopied += (uint32_t)parameters.copyAccumulated;
+  if (parameters.copyAccumulated > h->telemetry.repackMaxBytesCopied) {
+    h->telemetry.repackMaxBytesCopied = (uint32_t)parameters.copyAccumulated;
+  }
+#endif
   if ((parameters.status == SL_STATUS_OK) && (parameters.copyAllDone)) {
     // Mark page as ready to be erased.
     pageAdr = pageAdrFromIdx(h, h->fifoFirstIdx);
@@ -2461,6 +2515,9 @@ static sl_status_t eraseFirstPage(nvm3_Handle_t *h)
   sta = erasePage(h, h->fifoFirstIdx, eraseCnt);
   if (sta == SL_STATUS_OK) {
     h->unusedNvmSize += (h->halInfo.pageSize - NVM3_PAGE_HEADER_SIZE);
+#if NVM3_TELEMETRY
+    h->telemetry.pageEraseCount++;
+#endif
   }
 
   // Move first page index.
@@ -2539,6 +2596,9 @@ static sl_status_t repackWorker(nvm3_Handle_t *h, nvm3_PageState_t *pageState, r
   sl_status_t sta;
   nvm3_HalPtr_t pageAdr;
   nvm3_PageHdr_t pageHdr;
+#if NVM3_TELEMETRY
+  uint32_t ticks = telemetryTicks();
+#endif
 
   if (h->minUnused > h->unusedNvmSize) {
     h->minUnused = h->unusedNvmSize;
@@ -2564,6 +2624,20 @@ static sl_status_t repackWorker(nvm3_Handle_t *h, nvm3_PageState_t *pageState, r
     h->minUnused = h->unusedNvmSize;
   }
 
+#if NVM3_TELEMETRY
+  // Only nvm3_repack() copies some objects, every internal repack copies all.
+  if (copyMode == repackCopySome) {
+    h->telemetry.userRepackCount++;
+  } else {
+    h->telemetry.forcedRepackCount++;
+  }
+  ticks = telemetryTicks() - ticks;
+  h->telemetry.repackTicks += ticks;
+  if (ticks > h->telemetry.repackMaxTicks) {
+    h->telemetry.repackMaxTicks = ticks;
+  }
+#endif
+
   return sta;
 }
 
@@ -4160,6 +4234,57 @@ sl_status_t nvm3_getMemInfo(nvm3_Handle_t *h, nvm3_MemInfo_t *memInfo)
   return SL_STATUS_OK;
 }
 
+#if NVM3_TELEMETRY
+/******************************************************************************************************//**
+ * Retrieves the repack and write statistics for the NVM3 instance.
+ *********************************************************************************************************/
+sl_status_t nvm3_getTelemetry(nvm3_Handle_t *h, nvm3_Telemetry_t *telemetry)
+{
+  if ((h == NULL) || (telemetry == NULL)) {
+    NVM3_ERROR_ASSERT();
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (!h->hasBeenOpened) {
+    NVM3_ERROR_ASSERT();
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+  workBegin(h, NVM3_HAL_NVM_ACCESS_RD);
+
+  *telemetry = h->telemetry;
+
+  workEnd(h);
+  return SL_STATUS_OK;
+}
+
+/******************************************************************************************************//**
+ * Retrieves the erase count of every page in the NVM3 instance.
+ *********************************************************************************************************/
+sl_status_t nvm3_getPageEraseCounts(nvm3_Handle_t *h, uint32_t *eraseCnt, size_t *count)
+{
+  size_t idx;
+
+  if ((h == NULL) || (eraseCnt == NULL) || (count == NULL)) {
+    NVM3_ERROR_ASSERT();
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (!h->hasBeenOpened) {
+    NVM3_ERROR_ASSERT();
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+  workBegin(h, NVM3_HAL_NVM_ACCESS_RD);
+
+  if (*count > h->totalNvmPageCnt) {
+    *count = h->totalNvmPageCnt;
+  }
+  for (idx = 0U; idx < *count; idx++) {
+    eraseCnt[idx] = findCurrentEraseCnt(h, idx);
+  }
+
+  workEnd(h);
+  return SL_STATUS_OK;
+}
+#endif
+
 /******************************************************************************************************//**
  * Registers a callback function for an NVM3 instance.
  * This callback is invoked when the NVM3 instance detects low memory conditions or a cache overflow.
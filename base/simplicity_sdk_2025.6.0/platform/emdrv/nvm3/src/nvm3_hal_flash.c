@@ -51,10 +51,29 @@
 
 #define CHECK_DATA  1           ///< Macro defining if data should be checked
 
+// Program writes of at least NVM3_HAL_FLASH_DMA_WRITE_MIN_WORDS words from RAM
+// with the LDMA. MSC_WriteWordDma() waits for the channel to finish, so the
+// CPU is held for the write either way and the LDMA only takes over the
+// per-word WDATAREADY handshake. Enable with a project define.
+#ifndef NVM3_HAL_FLASH_DMA_WRITE_ENABLE
+#define NVM3_HAL_FLASH_DMA_WRITE_ENABLE     0
+#endif
+#ifndef NVM3_HAL_FLASH_DMA_WRITE_MIN_WORDS
+#define NVM3_HAL_FLASH_DMA_WRITE_MIN_WORDS  16
+#endif
+
+#if NVM3_HAL_FLASH_DMA_WRITE_ENABLE
+#include "dmadrv.h"
+#endif
+
 /******************************************************************************
  ***************************   LOCAL VARIABLES   ******************************
  *****************************************************************************/
 
+#if NVM3_HAL_FLASH_DMA_WRITE_ENABLE
+static int dmaChannel = -1;     ///< LDMA channel used for writes, -1 if none
+#endif
+
 /******************************************************************************
  ***************************   LOCAL FUNCTIONS   ******************************
  *****************************************************************************/
@@ -111,6 +130,22 @@ static bool isErased(void *adr, size_t len)
   return true;
 }
 
+#if NVM3_HAL_FLASH_DMA_WRITE_ENABLE
+// Check if a write should be programmed with the LDMA. The source must be
+// word aligned for the LDMA and must be in RAM, since fetching it from
+// flash would stall on the program cycle the DMA is feeding.
+static bool isDmaWrite(const uint32_t *src, size_t wordCnt)
+{
+  uint32_t srcAdr = (uint32_t)src;
+
+  return (dmaChannel >= 0)
+         && (wordCnt >= NVM3_HAL_FLASH_DMA_WRITE_MIN_WORDS)
+         && ((srcAdr % 4U) == 0U)
+         && (srcAdr >= SRAM_BASE)
+         && ((srcAdr + (wordCnt * sizeof(uint32_t))) <= (SRAM_BASE + SRAM_SIZE));
+}
+#endif
+
 /** @endcond */
 
 static sl_status_t nvm3_halFlashOpen(nvm3_HalPtr_t nvmAdr, size_t flashSize)
@@ -119,11 +154,31 @@ static sl_status_t nvm3_halFlashOpen(nvm3_HalPtr_t nvmAdr, size_t flashSize)
   (void)flashSize;
   MSC_Init();
 
+#if NVM3_HAL_FLASH_DMA_WRITE_ENABLE
+  // Without a channel all writes are programmed by the CPU.
+  if (dmaChannel < 0) {
+    Ecode_t ecode = DMADRV_Init();
+    unsigned int channel;
+
+    if (((ecode == ECODE_EMDRV_DMADRV_OK)
+         || (ecode == ECODE_EMDRV_DMADRV_ALREADY_INITIALIZED))
+        && (DMADRV_AllocateChannel(&channel, NULL) == ECODE_EMDRV_DMADRV_OK)) {
+      dmaChannel = (int)channel;
+    }
+  }
+#endif
+
   return SL_STATUS_OK;
 }
 
 static void nvm3_halFlashClose(void)
 {
+#if NVM3_HAL_FLASH_DMA_WRITE_ENABLE
+  if (dmaChannel >= 0) {
+    (void)DMADRV_FreeChannel((unsigned int)dmaChannel);
+    dmaChannel = -1;
+  }
+#endif
   MSC_Deinit();
 }
 
@@ -179,7 +234,14 @@ static sl_status_t nvm3_halFlashWriteWords(nvm3_HalPtr_t nvmAdr, void const *src
   size_t byteCnt;
 
   byteCnt = wordCnt * sizeof(uint32_t);
-  mscSta = MSC_WriteWord(pDst, pSrc, byteCnt);
+#if NVM3_HAL_FLASH_DMA_WRITE_ENABLE
+  if (isDmaWrite(pSrc, wordCnt)) {
+    mscSta = MSC_WriteWordDma(dmaChannel, pDst, pSrc, byteCnt);
+  } else
+#endif
+  {
+    mscSta = MSC_WriteWord(pDst, pSrc, byteCnt);
+  }
   halSta = convertMscStatusToNvm3Status(mscSta);
 
 #if CHECK_DATA
@@ -45,6 +45,9 @@
 #if defined(SL_COMPONENT_CATALOG_PRESENT)
 #include "sl_component_catalog.h"
 #endif
+#if defined(SL_CATALOG_CLOCK_MANAGER_PRESENT)
+#include "sli_clock_manager.h"
+#endif
 
 /***************************************************************************//**
  * @addtogroup cmu CMU - Clock Management Unit
@@ -263,6 +266,7 @@ static void     sysTickClkGet(uint32_t *freq, CMU_Select_TypeDef *sel);
 #if defined(USB_PRESENT)
 static void     usbClkGet(uint32_t *freq, CMU_Select_TypeDef *sel);
 #endif
+static void     clockTreeChanged(void);
 /** @endcond */
 
 // The following code is common for all SERIES_2 configurations.
@@ -792,6 +796,8 @@ void CMU_ClockDivSet(CMU_Clock_TypeDef clock, CMU_ClkDiv_TypeDef div)
       EFM_ASSERT(false);
       break;
   }
+
+  clockTreeChanged();
 }
 
 #if (_SILICON_LABS_32B_SERIES_2_CONFIG > 1)
@@ -2399,6 +2405,8 @@ void CMU_ClockSelectSet(CMU_Clock_TypeDef clock, CMU_Select_TypeDef ref)
       EFM_ASSERT(false);
       break;
   }
+
+  clockTreeChanged();
 }
 
 /***************************************************************************//**
@@ -2632,6 +2640,8 @@ void CMU_HFRCODPLLBandSet(CMU_HFRCODPLLFreq_TypeDef freq)
     EMU_VScaleEM01ByClock(0, true);
   }
 #endif
+
+  clockTreeChanged();
 }
 
 /**************************************************************************//**
@@ -2830,6 +2840,8 @@ bool CMU_DPLLLock(const CMU_DPLLInit_TypeDef *init)
 #endif
   }
 
+  clockTreeChanged();
+
   if (hfrcoClamped) {
     return false;
   } else if (lockStatus == DPLL_IF_LOCK) {
@@ -3993,6 +4005,8 @@ void CMU_HFRCOEM23BandSet(CMU_HFRCOEM23Freq_TypeDef freq)
 
   // Activate new band selection
   HFRCOEM23->CAL = freqCal;
+
+  clockTreeChanged();
 }
 #endif // defined(HFRCOEM23_PRESENT)
 
@@ -4578,6 +4592,18 @@ static uint32_t HFRCOEM23DevinfoGet(CMU_HFRCOEM23Freq_TypeDef freq)
 }
 #endif // defined(HFRCOEM23_PRESENT)
 
+/***************************************************************************//**
+ * @brief
+ *   Tell the Clock Manager that a clock select, divider or oscillator band
+ *   changed, so it drops the clock branch frequencies it cached.
+ ******************************************************************************/
+static void clockTreeChanged(void)
+{
+#if defined(SL_CATALOG_CLOCK_MANAGER_PRESENT)
+  sli_clock_manager_invalidate_clock_tree();
+#endif
+}
+
 /***************************************************************************//**
  * @brief
  *   Get selected oscillator and frequency for @ref cmuClock_TRACECLK
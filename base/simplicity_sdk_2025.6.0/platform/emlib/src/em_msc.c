@@ -705,6 +705,8 @@ MSC_RAMFUNC_DEFINITION_END
  * @verbatim
  *   flashReturnOk - The operation completed successfully.
  *   flashReturnInvalidAddr - The operation tried to erase a non-flash area.
+ *   flashReturnLocked - The operation tried to program a locked area.
+ *   flashReturnTimeOut - The operation timed out.
  * @endverbatim
  ******************************************************************************/
 MSC_Status_TypeDef MSC_WriteWordDma(int ch,
@@ -716,6 +718,7 @@ MSC_Status_TypeDef MSC_WriteWordDma(int ch,
   uint32_t burstLen;
   uint32_t src = (uint32_t) data;
   uint32_t dst = (uint32_t) address;
+  MSC_Status_TypeDef retVal = mscReturnOk;
   bool wasLocked;
 
   EFM_ASSERT((ch >= 0) && (ch < (int)DMA_CHAN_COUNT));
@@ -745,9 +748,10 @@ MSC_Status_TypeDef MSC_WriteWordDma(int ch,
     // Load the address.
     MSC->ADDRB = dst;
 
-    // Check for an invalid address.
+    // Check for an invalid address, leaving the MSC as it was found.
     if (MSC->STATUS & MSC_STATUS_INVADDR) {
-      return mscReturnInvalidAddr;
+      retVal = mscReturnInvalidAddr;
+      break;
     }
 
     LDMA->CH[ch].CTRL = LDMA_CH_CTRL_DSTINC_NONE
@@ -767,6 +771,13 @@ MSC_Status_TypeDef MSC_WriteWordDma(int ch,
     LDMA->CHDIS_SET = (0x1 << ch);
     MSC->WRITECMD = MSC_WRITECMD_WRITEEND;
 
+    // Wait for the last word to be programmed, as writeBurst() does, before
+    // the next burst or clearing WREN.
+    retVal = mscStatusWait((MSC_STATUS_BUSY | MSC_STATUS_PENDING), 0);
+    if (retVal != mscReturnOk) {
+      break;
+    }
+
     dst      += burstLen;
     src      += burstLen;
     numBytes -= burstLen;
@@ -779,7 +790,7 @@ MSC_Status_TypeDef MSC_WriteWordDma(int ch,
     MSC->LOCK = MSC_LOCK_LOCKKEY_LOCK;
   }
 
-  return mscReturnOk;
+  return retVal;
 }
 
 #else // defined(_SILICON_LABS_32B_SERIES_2)
@@ -171,6 +171,43 @@ RAIL_TxPowerCurvesConfigAlt_t powerCurvesState;
 
 const uint8_t sli_rail_supportedPaIndices[] = SUPPORTED_PA_INDICES;
 
+#if !defined(RISCVSEQUENCER) && !defined(RAIL_PA_CONVERSIONS_WEAK) && !defined(HAL_CONFIG)
+#include "sl_rail_util_pa_config.h"
+#endif
+#ifndef SL_RAIL_UTIL_PA_CONVERSION_CACHE_SIZE
+#define SL_RAIL_UTIL_PA_CONVERSION_CACHE_SIZE 0
+#endif
+
+#if (SL_RAIL_UTIL_PA_CONVERSION_CACHE_SIZE > 0) && !RAIL_SUPPORTS_DBM_POWERSETTING_MAPPING_TABLE
+#define PA_CONVERSION_CACHE 1
+
+// Per-PA tables filled by sl_rail_util_pa_init() from the curves, turning
+// both conversions into a single index. The dBm to raw table covers every
+// deci-dBm step between the curve limits and the raw to dBm table every
+// level from 0 to max; inputs outside those ranges give the same result as
+// the closest end, so they are clamped. A PA whose tables do not fit in the
+// pool, or curves installed later by RAIL_InitTxPowerCurvesAlt(), fall back
+// to the curve walk below.
+typedef struct {
+  RAIL_TxPower_t minPower;  // deci-dBm of the first dBm to raw entry
+  uint16_t powerCount;      // dBm to raw entries, 0 when not cached
+  uint16_t powerOffset;     // byte offset of the dBm to raw table
+  uint16_t levelCount;      // raw to dBm entries, 0 when not cached
+  uint16_t levelOffset;     // int16_t offset of the raw to dBm table
+} PaConversionCache_t;
+
+static PaConversionCache_t paConversionCache[RAIL_NUM_PA];
+static int16_t paConversionCachePool[(SL_RAIL_UTIL_PA_CONVERSION_CACHE_SIZE + 1) / 2];
+
+static void paConversionCacheInvalidate(void)
+{
+  for (uint32_t pa = 0U; pa < RAIL_NUM_PA; pa++) {
+    paConversionCache[pa].powerCount = 0U;
+    paConversionCache[pa].levelCount = 0U;
+  }
+}
+#endif
+
 #ifndef RISCVSEQUENCER
 #if defined(_SILICON_LABS_32B_SERIES_1) || defined(_SILICON_LABS_32B_SERIES_2_CONFIG_1)
   #define PA_CONVERSION_MINIMUM_PWRLVL 1U
@@ -228,6 +265,9 @@ RAIL_Status_t RAIL_InitTxPowerCurves(const RAIL_TxPowerCurvesConfig_t *config)
 #ifdef _SILICON_LABS_32B_SERIES_1
   // First PA is 2.4 GHz high power, using a piecewise fit
   RAIL_PaDescriptor_t *current = &powerCurvesState.curves[0];
+#ifdef PA_CONVERSION_CACHE
+  paConversionCacheInvalidate();
+#endif
   current->algorithm = RAIL_PA_ALGORITHM_PIECEWISE_LINEAR;
   current->segments = config->piecewiseSegments;
   current->min = RAIL_TX_POWER_LEVEL_2P4_HP_MIN;
@@ -290,6 +330,9 @@ RAIL_Status_t RAIL_InitTxPowerCurvesAlt(const RAIL_TxPowerCurvesConfigAlt_t *con
 {
   RAIL_Status_t status = RAIL_VerifyTxPowerCurves(config);
   if (status == RAIL_STATUS_NO_ERROR) {
+#ifdef PA_CONVERSION_CACHE
+    paConversionCacheInvalidate();
+#endif
     powerCurvesState = *config;
   }
   return status;
@@ -426,6 +469,21 @@ RAIL_TxPowerLevel_t RAIL_ConvertDbmToRaw(RAIL_Handle_t railHandle,
 
   if ((mode < sizeof(sli_rail_supportedPaIndices))
       && (sli_rail_supportedPaIndices[mode] < RAIL_NUM_PA)) {
+#ifdef PA_CONVERSION_CACHE
+    PaConversionCache_t const *cache = &paConversionCache[sli_rail_supportedPaIndices[mode]];
+    if (cache->powerCount > 0U) {
+      int32_t index = (int32_t)power - cache->minPower;
+      if (index < 0) {
+        index = 0;
+      } else if (index >= (int32_t)cache->powerCount) {
+        index = (int32_t)cache->powerCount - 1;
+      } else {
+        // Power is within the table (MISRA required else)
+      }
+      return ((uint8_t const *)paConversionCachePool)[cache->powerOffset + (uint32_t)index];
+    }
+#endif
+
     RAIL_PaDescriptor_t const *modeInfo = &powerCurvesState.curves[sli_rail_supportedPaIndices[mode]];
     uint32_t minPowerLevel = SL_MAX(modeInfo->min, PA_CONVERSION_MINIMUM_PWRLVL);
 
@@ -546,6 +604,14 @@ RAIL_TxPower_t RAIL_ConvertRawToDbm(RAIL_Handle_t railHandle,
 
   if ((mode < sizeof(sli_rail_supportedPaIndices))
       && (sli_rail_supportedPaIndices[mode] < RAIL_NUM_PA)) {
+#ifdef PA_CONVERSION_CACHE
+    PaConversionCache_t const *cache = &paConversionCache[sli_rail_supportedPaIndices[mode]];
+    if (cache->levelCount > 0U) {
+      uint32_t index = SL_MIN((uint32_t)powerLevel, cache->levelCount - 1U);
+      return paConversionCachePool[cache->levelOffset + index];
+    }
+#endif
+
     RAIL_PaDescriptor_t const *modeInfo = &powerCurvesState.curves[sli_rail_supportedPaIndices[mode]];
     if (modeInfo->algorithm == RAIL_PA_ALGORITHM_MAPPING_TABLE) {
       // Limit the max power level
@@ -697,6 +763,64 @@ static RAIL_TxPowerConfig_t txPowerConfigOFDM = {
 };
 #endif // RAIL_SUPPORTS_OFDM_PA
 
+#ifdef PA_CONVERSION_CACHE
+// Fill the conversion tables of every supported PA from the curves just
+// installed, using the regular conversions so the cached results are
+// identical to the uncached ones.
+static void paConversionCacheBuild(void)
+{
+  uint8_t *pool = (uint8_t *)paConversionCachePool;
+  uint32_t used = 0U;
+
+  paConversionCacheInvalidate();
+  for (uint32_t mode = 0U; mode < sizeof(sli_rail_supportedPaIndices); mode++) {
+    uint8_t pa = sli_rail_supportedPaIndices[mode];
+    if ((pa >= RAIL_NUM_PA) || (paConversionCache[pa].levelCount > 0U)) {
+      continue;
+    }
+    RAIL_PaDescriptor_t const *modeInfo = &powerCurvesState.curves[pa];
+    RAIL_TxPower_t minPower;
+    RAIL_TxPower_t maxPower;
+    if (modeInfo->algorithm == RAIL_PA_ALGORITHM_MAPPING_TABLE) {
+      minPower = modeInfo->conversion.mappingTable[0];
+      maxPower = modeInfo->conversion.mappingTable[modeInfo->max - SL_MAX(modeInfo->min, PA_CONVERSION_MINIMUM_PWRLVL)];
+    } else if (modeInfo->conversion.powerCurve != NULL) {
+      minPower = modeInfo->conversion.powerCurve->minPower;
+      maxPower = modeInfo->conversion.powerCurve->maxPower;
+    } else {
+      continue;
+    }
+    if ((maxPower < minPower) || (maxPower >= RAIL_TX_POWER_MAX)) {
+      continue;
+    }
+
+    // The int16_t table goes first so it stays aligned
+    uint32_t levelCount = (uint32_t)modeInfo->max + 1U;
+    uint32_t powerCount = (uint32_t)(maxPower - minPower) + 1U;
+    uint32_t levelOffset = (used + 1U) & ~1U;
+    uint32_t powerOffset = levelOffset + (levelCount * sizeof(int16_t));
+    if ((powerOffset + powerCount) > SL_RAIL_UTIL_PA_CONVERSION_CACHE_SIZE) {
+      continue;
+    }
+    for (uint32_t level = 0U; level < levelCount; level++) {
+      paConversionCachePool[(levelOffset / 2U) + level]
+        = RAIL_ConvertRawToDbm(RAIL_EFR32_HANDLE, (RAIL_TxPowerMode_t)mode, (RAIL_TxPowerLevel_t)level);
+    }
+    for (uint32_t index = 0U; index < powerCount; index++) {
+      pool[powerOffset + index]
+        = RAIL_ConvertDbmToRaw(RAIL_EFR32_HANDLE, (RAIL_TxPowerMode_t)mode, (RAIL_TxPower_t)(minPower + (RAIL_TxPower_t)index));
+    }
+    used = powerOffset + powerCount;
+
+    paConversionCache[pa].minPower = minPower;
+    paConversionCache[pa].powerOffset = (uint16_t)powerOffset;
+    paConversionCache[pa].levelOffset = (uint16_t)(levelOffset / 2U);
+    paConversionCache[pa].powerCount = (uint16_t)powerCount;
+    paConversionCache[pa].levelCount = (uint16_t)levelCount;
+  }
+}
+#endif
+
 void sl_rail_util_pa_init(void)
 {
   const RAIL_TxPowerCurvesConfigAlt_t *txPowerCurves;
@@ -752,7 +876,13 @@ void sl_rail_util_pa_init(void)
   }
 #endif//SL_RAIL_UTIL_PA_NVM_ENABLED
 
+#ifdef PA_CONVERSION_CACHE
+  if (RAIL_InitTxPowerCurvesAlt(txPowerCurves) == RAIL_STATUS_NO_ERROR) {
+    paConversionCacheBuild();
+  }
+#else
   (void)RAIL_InitTxPowerCurvesAlt(txPowerCurves);
+#endif
 
 #if SL_RAIL_UTIL_PA_CALIBRATION_ENABLE
   RAIL_EnablePaCal(true);
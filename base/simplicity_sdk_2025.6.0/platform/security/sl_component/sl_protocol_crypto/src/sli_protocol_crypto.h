@@ -212,6 +212,17 @@ int sli_process_ble_rpa(const unsigned char keytable[],
                         uint32_t            prand,
                         uint32_t            hash);
 
+/***************************************************************************//**
+ * @brief          Forget the RPA resolutions cached by sli_process_ble_rpa
+ *
+ * @note           The cache is dropped by sli_process_ble_rpa when the key
+ *                 table pointer or key mask passed to it changes. A key
+ *                 replaced in place under the same mask is not detected, the
+ *                 owner of the key table must call this function after
+ *                 changing it.
+ ******************************************************************************/
+void sli_process_ble_rpa_cache_invalidate(void);
+
 #ifdef __cplusplus
 }
 #endif
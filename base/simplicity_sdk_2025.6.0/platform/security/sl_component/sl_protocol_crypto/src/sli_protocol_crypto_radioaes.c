@@ -47,6 +47,11 @@
 #define RADIOAES_BLE_RPA_MAX_KEYS 32
 #endif
 
+/// Number of resolved RPAs remembered by sli_process_ble_rpa, 0 to disable
+#ifndef RADIOAES_BLE_RPA_CACHE_SIZE
+#define RADIOAES_BLE_RPA_CACHE_SIZE 8
+#endif
+
 /// value for sli_radioaes_dma_sg_descr.tag to direct data to parameters
 #define DMA_SG_TAG_ISCONFIG 0x00000010
 /// value for sli_radioaes_dma_sg_descr.tag to direct data to processing
@@ -188,6 +193,25 @@ static const uint32_t aes_ccm_config_decrypt = AES_MODEID_CCM
                                                | AES_MODEID_DECRYPT;
 static const uint32_t zeros = 0;
 
+/// ble_rpa_resolve result when the RADIOAES could not be acquired
+#define BLE_RPA_RESOLVE_FAILED (-2)
+
+#if RADIOAES_BLE_RPA_CACHE_SIZE > 0
+// Result of a previous RPA resolution
+typedef struct {
+  uint32_t prand;
+  uint32_t hash;
+  int      result;
+  bool     valid;
+} ble_rpa_cache_entry_t;
+
+// RPA resolution cache, valid for the key table it was filled from
+static ble_rpa_cache_entry_t ble_rpa_cache[RADIOAES_BLE_RPA_CACHE_SIZE];
+static const unsigned char *ble_rpa_cache_keytable = NULL;
+static uint32_t ble_rpa_cache_keymask = 0;
+static uint8_t ble_rpa_cache_next = 0;
+#endif
+
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLI_PROTOCOL_CRYPTO, SL_CODE_CLASS_TIME_CRITICAL)
 static sl_status_t sli_radioaes_run_operation(sli_radioaes_dma_descr_t *first_fetch_descriptor,
                                               sli_radioaes_dma_descr_t *first_push_descriptor)
@@ -725,13 +749,14 @@ sl_status_t sli_ccm_zigbee(bool encrypt,
 }
 
 //
-// Process a table of BLE RPA device keys and look for a
+// Run the RPA hash of each key in the table on the RADIOAES and look for a
 // match against the supplied hash. Algorithm is AES-128.
 //
-int sli_process_ble_rpa(const unsigned char keytable[],
-                        uint32_t            keymask,
-                        uint32_t            prand,
-                        uint32_t            hash)
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLI_PROTOCOL_CRYPTO, SL_CODE_CLASS_TIME_CRITICAL)
+static int ble_rpa_resolve(const unsigned char keytable[],
+                           uint32_t            keymask,
+                           uint32_t            prand,
+                           uint32_t            hash)
 {
   int block;
   int previous_block = -1, result = -1;
@@ -780,7 +805,7 @@ int sli_process_ble_rpa(const unsigned char keytable[],
   if (status == SL_STATUS_ISR) {
     sli_radioaes_save_state(&aes_ctx);
   } else if (status != SL_STATUS_OK) {
-    return -1;
+    return BLE_RPA_RESOLVE_FAILED;
   }
 
   RADIOAES->CTRL = AES_CTRL_FETCHERSCATTERGATHER | AES_CTRL_PUSHERSCATTERGATHER;
@@ -856,6 +881,92 @@ int sli_process_ble_rpa(const unsigned char keytable[],
   return -1;
 }
 
+//
+// Process a table of BLE RPA device keys and look for a
+// match against the supplied hash. Results are cached per RPA so that
+// addresses seen repeatedly are resolved without running the AES.
+//
+int sli_process_ble_rpa(const unsigned char keytable[],
+                        uint32_t            keymask,
+                        uint32_t            prand,
+                        uint32_t            hash)
+{
+#if RADIOAES_BLE_RPA_CACHE_SIZE > 0
+  int result = -1;
+  bool hit = false;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_CRITICAL();
+  if ((keytable != ble_rpa_cache_keytable)
+      || (keymask != ble_rpa_cache_keymask)) {
+    // Key table changed, forget all results. Keys replaced in place are
+    // reported through sli_process_ble_rpa_cache_invalidate.
+    for (size_t i = 0; i < RADIOAES_BLE_RPA_CACHE_SIZE; i++) {
+      ble_rpa_cache[i].valid = false;
+    }
+    ble_rpa_cache_keytable = keytable;
+    ble_rpa_cache_keymask = keymask;
+  } else {
+    for (size_t i = 0; i < RADIOAES_BLE_RPA_CACHE_SIZE; i++) {
+      if (ble_rpa_cache[i].valid
+          && (ble_rpa_cache[i].prand == prand)
+          && (ble_rpa_cache[i].hash == hash)) {
+        result = ble_rpa_cache[i].result;
+        hit = true;
+        break;
+      }
+    }
+  }
+  CORE_EXIT_CRITICAL();
+
+  if (hit) {
+    return result;
+  }
+
+  result = ble_rpa_resolve(keytable, keymask, prand, hash);
+  if (result == BLE_RPA_RESOLVE_FAILED) {
+    // The key table was not processed, nothing to remember.
+    return -1;
+  }
+
+  CORE_ENTER_CRITICAL();
+  // The key table may have been replaced while the AES was running.
+  if ((keytable == ble_rpa_cache_keytable)
+      && (keymask == ble_rpa_cache_keymask)) {
+    ble_rpa_cache[ble_rpa_cache_next].prand = prand;
+    ble_rpa_cache[ble_rpa_cache_next].hash = hash;
+    ble_rpa_cache[ble_rpa_cache_next].result = result;
+    ble_rpa_cache[ble_rpa_cache_next].valid = true;
+    ble_rpa_cache_next = (uint8_t)((ble_rpa_cache_next + 1) % RADIOAES_BLE_RPA_CACHE_SIZE);
+  }
+  CORE_EXIT_CRITICAL();
+
+  return result;
+#else
+  int result = ble_rpa_resolve(keytable, keymask, prand, hash);
+  return (result == BLE_RPA_RESOLVE_FAILED) ? -1 : result;
+#endif
+}
+
+//
+// Forget all cached RPA resolutions.
+//
+void sli_process_ble_rpa_cache_invalidate(void)
+{
+#if RADIOAES_BLE_RPA_CACHE_SIZE > 0
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_CRITICAL();
+  for (size_t i = 0; i < RADIOAES_BLE_RPA_CACHE_SIZE; i++) {
+    ble_rpa_cache[i].valid = false;
+  }
+  // Also drops a resolution running now, see the key table check after
+  // ble_rpa_resolve.
+  ble_rpa_cache_keytable = NULL;
+  CORE_EXIT_CRITICAL();
+#endif
+}
+
 void sli_aes_seed_mask(void)
 {
   // Acquiring and releasing the peripheral should ensure the mask is properly
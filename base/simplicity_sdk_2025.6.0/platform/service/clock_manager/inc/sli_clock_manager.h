@@ -58,6 +58,36 @@ __WEAK void sli_clock_manager_notify_hfxo_ready(void);
  ******************************************************************************/
 sl_status_t sli_clock_manager_get_hfxo_average_startup_time(uint32_t *val);
 
+/***************************************************************************//**
+ * Invalidates the clock branch frequency cache.
+ *
+ * @note sl_clock_manager_get_clock_branch_frequency() caches its results until
+ *       the clock tree changes. The Clock Manager, the Power Manager and the
+ *       emlib CMU clock select, divider, HFRCO band and DPLL functions call
+ *       this on every change they make. Code writing CMU, HFRCO or DPLL
+ *       registers directly must call it as well.
+ ******************************************************************************/
+void sli_clock_manager_invalidate_clock_tree(void);
+
+/***************************************************************************//**
+ * Saves the clock tree generation before a temporary clock switch, such as
+ * moving the HF clocks to FSRCO before deepsleep, and invalidates the cache.
+ *
+ * @note Only the first call saves the generation; later calls before
+ *       sli_clock_manager_restore_clock_tree() only invalidate the cache.
+ ******************************************************************************/
+void sli_clock_manager_save_clock_tree(void);
+
+/***************************************************************************//**
+ * Restores the clock tree generation saved by sli_clock_manager_save_clock_tree()
+ * once the clocks are back to their saved configuration. Entries cached before
+ * the switch become valid again.
+ *
+ * @note If sli_clock_manager_invalidate_clock_tree() was called in between,
+ *       the cache is invalidated instead.
+ ******************************************************************************/
+void sli_clock_manager_restore_clock_tree(void);
+
 #ifdef __cplusplus
 }
 #endif
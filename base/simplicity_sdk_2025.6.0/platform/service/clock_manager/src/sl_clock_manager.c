@@ -32,8 +32,100 @@
 #include "sli_clock_manager.h"
 #include "sli_clock_manager_hal.h"
 #include "sl_assert.h"
+#include "sl_core.h"
 #include "cmsis_compiler.h"
 
+/*******************************************************************************
+ *********************************   DEFINES   *********************************
+ ******************************************************************************/
+
+// Number of clock branches held in the frequency cache.
+#define CLOCK_BRANCH_COUNT  ((uint32_t)SL_CLOCK_BRANCH_INVALID)
+
+/*******************************************************************************
+ ***************************  LOCAL VARIABLES   ********************************
+ ******************************************************************************/
+
+// Branch frequency cache. An entry is valid when its generation matches the
+// current clock tree generation. Generation 0 is never used by the tree so the
+// zero-initialized table starts out empty.
+static uint32_t branch_frequency[CLOCK_BRANCH_COUNT];
+static uint32_t branch_generation[CLOCK_BRANCH_COUNT];
+
+// Current clock tree generation and the last value handed out.
+static uint32_t tree_generation = 1u;
+static uint32_t tree_generation_last = 1u;
+
+// Generation stashed while the power manager holds the tree on FSRCO.
+static uint32_t tree_generation_saved = 0u;
+
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Moves the clock tree to a fresh generation, dropping every cached entry.
+ *
+ * @note Must be called inside a critical section.
+ ******************************************************************************/
+static void clock_tree_new_generation(void)
+{
+  tree_generation_last++;
+  if (tree_generation_last == 0u) {
+    tree_generation_last = 1u;
+  }
+  tree_generation = tree_generation_last;
+}
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Invalidates the clock branch frequency cache.
+ ******************************************************************************/
+void sli_clock_manager_invalidate_clock_tree(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  tree_generation_saved = 0u;
+  clock_tree_new_generation();
+  CORE_EXIT_ATOMIC();
+}
+
+/***************************************************************************//**
+ * Saves the clock tree generation before a temporary clock switch.
+ ******************************************************************************/
+void sli_clock_manager_save_clock_tree(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  if (tree_generation_saved == 0u) {
+    tree_generation_saved = tree_generation;
+  }
+  clock_tree_new_generation();
+  CORE_EXIT_ATOMIC();
+}
+
+/***************************************************************************//**
+ * Restores the clock tree generation saved before a temporary clock switch.
+ ******************************************************************************/
+void sli_clock_manager_restore_clock_tree(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  if (tree_generation_saved != 0u) {
+    tree_generation = tree_generation_saved;
+    tree_generation_saved = 0u;
+  } else {
+    clock_tree_new_generation();
+  }
+  CORE_EXIT_ATOMIC();
+}
+
 /***************************************************************************//**
  * Performs Clock Manager runtime initialization.
  ******************************************************************************/
@@ -74,11 +166,41 @@ sl_status_t sl_clock_manager_get_oscillator_precision(sl_oscillator_t oscillator
 sl_status_t sl_clock_manager_get_clock_branch_frequency(sl_clock_branch_t clock_branch,
                                                         uint32_t          *frequency)
 {
+  sl_status_t status;
+  uint32_t generation;
+  CORE_DECLARE_IRQ_STATE;
+
   if (frequency == NULL) {
     return SL_STATUS_NULL_POINTER;
   }
 
-  return sli_clock_manager_hal_get_clock_branch_frequency(clock_branch, frequency);
+  if ((uint32_t)clock_branch >= CLOCK_BRANCH_COUNT) {
+    return sli_clock_manager_hal_get_clock_branch_frequency(clock_branch, frequency);
+  }
+
+  CORE_ENTER_ATOMIC();
+  generation = tree_generation;
+  if (branch_generation[clock_branch] == generation) {
+    *frequency = branch_frequency[clock_branch];
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_OK;
+  }
+  CORE_EXIT_ATOMIC();
+
+  status = sli_clock_manager_hal_get_clock_branch_frequency(clock_branch, frequency);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  // Only fill the entry if the tree did not change during the lookup.
+  CORE_ENTER_ATOMIC();
+  if (tree_generation == generation) {
+    branch_frequency[clock_branch] = *frequency;
+    branch_generation[clock_branch] = generation;
+  }
+  CORE_EXIT_ATOMIC();
+
+  return SL_STATUS_OK;
 }
 
 /***************************************************************************//**
@@ -271,7 +393,11 @@ sl_status_t sl_clock_manager_get_rco_calibration_count(uint32_t *count)
  ******************************************************************************/
 sl_status_t slx_clock_manager_set_sysclk_source(sl_oscillator_t oscillator)
 {
-  return sli_clock_manager_hal_set_sysclk_source(oscillator);
+  sl_status_t status = sli_clock_manager_hal_set_sysclk_source(oscillator);
+
+  sli_clock_manager_invalidate_clock_tree();
+
+  return status;
 }
 
 /***************************************************************************//**
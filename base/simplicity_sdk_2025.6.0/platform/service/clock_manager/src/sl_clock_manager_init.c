@@ -30,11 +30,17 @@
 
 #include "sl_clock_manager_init.h"
 #include "sli_clock_manager_init_hal.h"
+#include "sli_clock_manager.h"
 
 /***************************************************************************//**
  * Initializes Oscillators and Clock branches.
  ******************************************************************************/
 sl_status_t sl_clock_manager_init(void)
 {
-  return sli_clock_manager_hal_init();
+  sl_status_t status = sli_clock_manager_hal_init();
+
+  // Branch frequencies may have been queried before the tree was configured.
+  sli_clock_manager_invalidate_clock_tree();
+
+  return status;
 }
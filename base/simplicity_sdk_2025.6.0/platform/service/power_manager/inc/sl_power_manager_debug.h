@@ -32,6 +32,7 @@
 #define SL_POWER_MANAGER_DEBUG_H
 
 #include "sl_power_manager.h"
+#include "em_device.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -42,6 +43,36 @@ extern "C" {
  * @{
  ******************************************************************************/
 
+// -----------------------------------------------------------------------------
+// Defines
+
+/// Number of wakeup histogram entries: one per external IRQ number plus one for
+/// wakeups without any pending external interrupt.
+#define SL_POWER_MANAGER_DEBUG_WAKEUP_SOURCE_COUNT  (EXT_IRQ_COUNT + 1)
+
+/// Wakeup histogram index for wakeups without any pending external interrupt.
+#define SL_POWER_MANAGER_DEBUG_WAKEUP_OTHER         (EXT_IRQ_COUNT)
+
+// -----------------------------------------------------------------------------
+// Data Types
+
+/// @brief Energy mode residency and wakeup statistics.
+typedef struct {
+  uint64_t elapsed_ticks;                                           ///< Sleeptimer ticks since the statistics were reset.
+  uint64_t em_ticks[SL_POWER_MANAGER_EM3 + 1];                      ///< Sleeptimer ticks spent in each energy mode. EM0 gets the time not spent sleeping.
+  uint32_t em_entry_count[SL_POWER_MANAGER_EM3 + 1];                ///< Number of times each energy mode was entered. Not counted for EM0.
+  uint32_t wakeup_count[SL_POWER_MANAGER_DEBUG_WAKEUP_SOURCE_COUNT]; ///< Wakeups per IRQ number.
+} sl_power_manager_debug_statistics_t;
+
+/// @brief Hold time of the EM1 requirements added by one module.
+typedef struct {
+  const char *module_name;  ///< Module name given by CURRENT_MODULE_NAME.
+  uint8_t active_count;     ///< Number of requirements currently held.
+  uint32_t hold_count;      ///< Number of completed holds, counted when the module releases its last requirement.
+  uint64_t hold_ticks;      ///< Sleeptimer ticks during which the module held at least one requirement.
+  uint32_t max_hold_ticks;  ///< Longest completed hold in sleeptimer ticks.
+} sl_power_manager_debug_requirement_hold_t;
+
 // -----------------------------------------------------------------------------
 // Prototypes
 
@@ -51,6 +82,48 @@ extern "C" {
  ******************************************************************************/
 void sl_power_manager_debug_print_em_requirements(void);
 
+/***************************************************************************//**
+ * Gets the energy mode residency and wakeup statistics.
+ *
+ * @param[out] statistics  Statistics accumulated since the Power Manager
+ *                         initialization or the last reset.
+ *
+ * @note Available when SL_POWER_MANAGER_DEBUG_STATISTICS is enabled.
+ ******************************************************************************/
+void sl_power_manager_debug_get_statistics(sl_power_manager_debug_statistics_t *statistics);
+
+/***************************************************************************//**
+ * Gets the EM1 requirement hold time of one module.
+ *
+ * @param[in]  index  Index of the module, starting at 0.
+ *
+ * @param[out] hold   Hold time of the module. A hold still in progress is
+ *                    included in hold_ticks up to now.
+ *
+ * @return  SL_STATUS_OK if successful.
+ *          SL_STATUS_NOT_FOUND if no module is recorded at this index.
+ *
+ * @note Available when SL_POWER_MANAGER_DEBUG_STATISTICS is enabled. Only
+ *       requirements added through sl_power_manager_add_em_requirement() from
+ *       code built with the debug feature are recorded.
+ ******************************************************************************/
+sl_status_t sl_power_manager_debug_get_requirement_hold(uint32_t                                  index,
+                                                        sl_power_manager_debug_requirement_hold_t *hold);
+
+/***************************************************************************//**
+ * Resets the energy mode residency, wakeup and requirement hold statistics.
+ *
+ * @note Available when SL_POWER_MANAGER_DEBUG_STATISTICS is enabled.
+ ******************************************************************************/
+void sl_power_manager_debug_reset_statistics(void);
+
+/***************************************************************************//**
+ * Print the energy mode residency, wakeup and requirement hold statistics.
+ *
+ * @note Available when SL_POWER_MANAGER_DEBUG_STATISTICS is enabled.
+ ******************************************************************************/
+void sl_power_manager_debug_print_statistics(void);
+
 /** @} (end addtogroup power_manager) */
 
 #ifdef __cplusplus
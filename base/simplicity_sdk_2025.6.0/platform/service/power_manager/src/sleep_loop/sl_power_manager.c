@@ -131,6 +131,9 @@ static volatile bool is_restored_from_hfxo_isr_internal = false;
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_POWER_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
 static sl_power_manager_em_t get_lowest_em(void);
 
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_POWER_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
+static void apply_em(sl_power_manager_em_t em);
+
 #if !defined(SL_CATALOG_POWER_MANAGER_NO_DEEPSLEEP_PRESENT)
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_POWER_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
 static void evaluate_wakeup(sl_power_manager_em_t to);
@@ -316,7 +319,7 @@ __NO_INLINE void sl_power_manager_sleep(void)
     }
 
     // Apply lowest reachable energy mode
-    sli_power_manager_apply_em(current_em);
+    apply_em(current_em);
 
     // In case we are waiting for the restore from an early wake-up,
     // we put back the current EM to the one before the early wake-up to do the next notification correctly.
@@ -357,7 +360,7 @@ __NO_INLINE void sl_power_manager_sleep(void)
     }
     // If possible, go back to sleep in EM1 while waiting for HF accuracy restore
     while (!sli_power_manager_is_high_freq_accuracy_clk_ready(false)) {
-      sli_power_manager_apply_em(SL_POWER_MANAGER_EM1);
+      apply_em(SL_POWER_MANAGER_EM1);
       primask_state = yield_critical_with_primask(primask_state);
     }
     sli_power_manager_restore_states();
@@ -387,7 +390,7 @@ __NO_INLINE void sl_power_manager_sleep(void)
     // Apply EM1 energy mode
     // Lowest EM is passed so that further actions can be taking by the HAL based on the EM requirements
     // but only EM1 sleep will be entered.
-    sli_power_manager_apply_em(lowest_em);
+    apply_em(lowest_em);
 
     primask_state = yield_critical_with_primask(primask_state);
   } while (sl_power_manager_sleep_on_isr_exit() == true);
@@ -777,6 +780,26 @@ static sl_power_manager_em_t get_lowest_em(void)
   return em;
 }
 
+/***************************************************************************//**
+ * Applies the given energy mode and, when the debug statistics are enabled,
+ * accounts the time spent in it and the interrupt that woke the system up.
+ *
+ * @param em  Energy mode to apply.
+ *
+ * @note Must be called with interrupts disabled.
+ ******************************************************************************/
+static void apply_em(sl_power_manager_em_t em)
+{
+#if defined(SLI_POWER_MANAGER_DEBUG_STATISTICS_EN)
+  uint32_t start_tick = sl_sleeptimer_get_tick_count();
+
+  sli_power_manager_apply_em(em);
+  sli_power_manager_debug_log_sleep(em, start_tick);
+#else
+  sli_power_manager_apply_em(em);
+#endif
+}
+
 /***************************************************************************//**
  * Enter critical section by disabling interrupts using PriMask.
  *
@@ -32,6 +32,7 @@
 #include "sl_power_manager_config.h"
 #include "sl_power_manager_debug.h"
 #include "sli_power_manager_private.h"
+#include "sl_assert.h"
 
 #if (SL_POWER_MANAGER_DEBUG == 1)
 #include <stdio.h>
@@ -44,10 +45,23 @@ static sli_power_debug_requirement_entry_t  power_debug_entry_table[SL_POWER_MAN
 static sl_slist_node_t *power_debug_free_entry_list = NULL;
 static bool power_debug_ran_out_of_entry = false;
 
+#if defined(SLI_POWER_MANAGER_DEBUG_STATISTICS_EN)
+static sl_power_manager_debug_statistics_t power_debug_statistics;
+static uint64_t power_debug_statistics_start_tick;
+static sl_power_manager_debug_requirement_hold_t power_debug_hold_table[SL_POWER_MANAGER_DEBUG_POOL_SIZE];
+static uint32_t power_debug_hold_start_tick[SL_POWER_MANAGER_DEBUG_POOL_SIZE];
+static bool power_debug_ran_out_of_hold_entry = false;
+#endif
+
 static void power_manager_log_add_requirement(sl_slist_node_t **p_list,
                                               bool            add,
                                               const char      *name);
 
+#if defined(SLI_POWER_MANAGER_DEBUG_STATISTICS_EN)
+static void power_manager_log_hold(bool       add,
+                                   const char *name);
+#endif
+
 /***************************************************************************//**
  * Print a fancy table that describes the current requirements on each energy
  * mode and their owner.
@@ -84,6 +98,10 @@ void sli_power_manager_debug_init(void)
     sli_power_debug_requirement_entry_t  *entry = &power_debug_entry_table[i];
     sl_slist_push(&power_debug_free_entry_list, &entry->node);
   }
+
+#if defined(SLI_POWER_MANAGER_DEBUG_STATISTICS_EN)
+  power_debug_statistics_start_tick = sl_sleeptimer_get_tick_count64();
+#endif
 }
 
 /***************************************************************************//**
@@ -134,6 +152,225 @@ static void power_manager_log_add_requirement(sl_slist_node_t **p_list,
     sl_slist_push(&power_debug_free_entry_list, &entry_remove->node);
   }
 }
+
+#if defined(SLI_POWER_MANAGER_DEBUG_STATISTICS_EN)
+/***************************************************************************//**
+ * Gets the energy mode residency and wakeup statistics.
+ ******************************************************************************/
+void sl_power_manager_debug_get_statistics(sl_power_manager_debug_statistics_t *statistics)
+{
+  uint64_t sleep_ticks;
+  CORE_DECLARE_IRQ_STATE;
+
+  EFM_ASSERT(statistics != NULL);
+
+  CORE_ENTER_CRITICAL();
+  *statistics = power_debug_statistics;
+  statistics->elapsed_ticks = sl_sleeptimer_get_tick_count64() - power_debug_statistics_start_tick;
+  CORE_EXIT_CRITICAL();
+
+  sleep_ticks = statistics->em_ticks[SL_POWER_MANAGER_EM1]
+                + statistics->em_ticks[SL_POWER_MANAGER_EM2]
+                + statistics->em_ticks[SL_POWER_MANAGER_EM3];
+  statistics->em_ticks[SL_POWER_MANAGER_EM0] = (statistics->elapsed_ticks > sleep_ticks)
+                                               ? (statistics->elapsed_ticks - sleep_ticks) : 0;
+}
+
+/***************************************************************************//**
+ * Gets the EM1 requirement hold time of one module.
+ ******************************************************************************/
+sl_status_t sl_power_manager_debug_get_requirement_hold(uint32_t                                  index,
+                                                        sl_power_manager_debug_requirement_hold_t *hold)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  EFM_ASSERT(hold != NULL);
+
+  if (index >= SL_POWER_MANAGER_DEBUG_POOL_SIZE) {
+    return SL_STATUS_NOT_FOUND;
+  }
+
+  CORE_ENTER_CRITICAL();
+  if (power_debug_hold_table[index].module_name == NULL) {
+    CORE_EXIT_CRITICAL();
+    return SL_STATUS_NOT_FOUND;
+  }
+  *hold = power_debug_hold_table[index];
+  if (hold->active_count != 0) {
+    hold->hold_ticks += sl_sleeptimer_get_tick_count() - power_debug_hold_start_tick[index];
+  }
+  CORE_EXIT_CRITICAL();
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Resets the energy mode residency, wakeup and requirement hold statistics.
+ ******************************************************************************/
+void sl_power_manager_debug_reset_statistics(void)
+{
+  uint32_t now;
+  uint32_t i;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_CRITICAL();
+  memset(&power_debug_statistics, 0, sizeof(power_debug_statistics));
+  power_debug_statistics_start_tick = sl_sleeptimer_get_tick_count64();
+
+  // Keep the modules and their current holds, restart the hold time from now.
+  now = sl_sleeptimer_get_tick_count();
+  for (i = 0; i < SL_POWER_MANAGER_DEBUG_POOL_SIZE; i++) {
+    power_debug_hold_table[i].hold_count = 0;
+    power_debug_hold_table[i].hold_ticks = 0;
+    power_debug_hold_table[i].max_hold_ticks = 0;
+    power_debug_hold_start_tick[i] = now;
+  }
+  CORE_EXIT_CRITICAL();
+}
+
+/***************************************************************************//**
+ * Print the energy mode residency, wakeup and requirement hold statistics.
+ ******************************************************************************/
+void sl_power_manager_debug_print_statistics(void)
+{
+  sl_power_manager_debug_statistics_t statistics;
+  sl_power_manager_debug_requirement_hold_t hold;
+  uint64_t ms;
+  uint32_t i;
+
+  sl_power_manager_debug_get_statistics(&statistics);
+
+  if (power_debug_ran_out_of_hold_entry) {
+    printf("WARNING: The system ran out of Debug Entry; The hold report is likely to be incomplete. Increase SL_POWER_MANAGER_DEBUG_POOL_SIZE\n\n");
+  }
+  printf("------------------------------------------\n");
+  printf("| EM residency\n");
+  printf("------------------------------------------\n");
+  for (i = SL_POWER_MANAGER_EM0; i <= SL_POWER_MANAGER_EM3; i++) {
+    ms = 0;
+    sl_sleeptimer_tick64_to_ms(statistics.em_ticks[i], &ms);
+    printf("| EM%lu: %lu ms, %lu entries\n", i, (uint32_t)ms, statistics.em_entry_count[i]);
+  }
+  printf("------------------------------------------\n");
+  printf("| Wakeup sources\n");
+  printf("------------------------------------------\n");
+  for (i = 0; i < SL_POWER_MANAGER_DEBUG_WAKEUP_OTHER; i++) {
+    if (statistics.wakeup_count[i] != 0) {
+      printf("| IRQ %lu: %lu\n", i, statistics.wakeup_count[i]);
+    }
+  }
+  if (statistics.wakeup_count[SL_POWER_MANAGER_DEBUG_WAKEUP_OTHER] != 0) {
+    printf("| Other: %lu\n", statistics.wakeup_count[SL_POWER_MANAGER_DEBUG_WAKEUP_OTHER]);
+  }
+  printf("------------------------------------------\n");
+  printf("| EM1 requirement hold time\n");
+  printf("------------------------------------------\n");
+  for (i = 0; sl_power_manager_debug_get_requirement_hold(i, &hold) == SL_STATUS_OK; i++) {
+    ms = 0;
+    sl_sleeptimer_tick64_to_ms(hold.hold_ticks, &ms);
+    printf("| %s: %lu holds, %lu ms total, %lu ms max, %u held\n",
+           hold.module_name,
+           hold.hold_count,
+           (uint32_t)ms,
+           sl_sleeptimer_tick_to_ms(hold.max_hold_ticks),
+           hold.active_count);
+  }
+  printf("------------------------------------------\n");
+}
+
+/***************************************************************************//**
+ * Accounts a sleep period and the interrupt that ended it.
+ ******************************************************************************/
+void sli_power_manager_debug_log_sleep(sl_power_manager_em_t em,
+                                       uint32_t              start_tick)
+{
+  uint32_t irq = SL_POWER_MANAGER_DEBUG_WAKEUP_OTHER;
+  uint32_t i;
+
+#if defined(SL_CATALOG_POWER_MANAGER_NO_DEEPSLEEP_PRESENT)
+  // Only EM1 is entered, whatever the requirements allow.
+  em = SL_POWER_MANAGER_EM1;
+#endif
+  if (em > SL_POWER_MANAGER_EM3) {
+    return;
+  }
+
+  power_debug_statistics.em_ticks[em] += sl_sleeptimer_get_tick_count() - start_tick;
+  power_debug_statistics.em_entry_count[em]++;
+
+  // Interrupts are still disabled, so the waking interrupt is still pending.
+  // Attribute the wakeup to the lowest pending and enabled IRQ number.
+  for (i = 0; i < ((EXT_IRQ_COUNT + 31) / 32); i++) {
+    uint32_t pending = NVIC->ISPR[i] & NVIC->ISER[i];
+    if (pending != 0) {
+      irq = (i * 32) + __CLZ(__RBIT(pending));
+      break;
+    }
+  }
+  if (irq > SL_POWER_MANAGER_DEBUG_WAKEUP_OTHER) {
+    irq = SL_POWER_MANAGER_DEBUG_WAKEUP_OTHER;
+  }
+  power_debug_statistics.wakeup_count[irq]++;
+}
+
+/***************************************************************************//**
+ * Log requirement hold time
+ *
+ * @param add     Add (true) or remove (false) the requirement.
+ *
+ * @param name    Module name that acquired or remove the requirement.
+ ******************************************************************************/
+static void power_manager_log_hold(bool       add,
+                                   const char *name)
+{
+  sl_power_manager_debug_requirement_hold_t *hold = NULL;
+  uint32_t ticks;
+  uint32_t i;
+
+  for (i = 0; i < SL_POWER_MANAGER_DEBUG_POOL_SIZE; i++) {
+    if (power_debug_hold_table[i].module_name == NULL) {
+      if (add == true) {
+        // Modules are never removed, the first free entry ends the search.
+        hold = &power_debug_hold_table[i];
+        hold->module_name = name;
+      }
+      break;
+    }
+    if ((power_debug_hold_table[i].module_name == name)
+        || (strcmp(power_debug_hold_table[i].module_name, name) == 0)) {
+      hold = &power_debug_hold_table[i];
+      break;
+    }
+  }
+
+  if (hold == NULL) {
+    if (add == true) {
+      power_debug_ran_out_of_hold_entry = true;
+    }
+    return;
+  }
+
+  if (add == true) {
+    if (hold->active_count == 0) {
+      power_debug_hold_start_tick[i] = sl_sleeptimer_get_tick_count();
+    }
+    if (hold->active_count < UINT8_MAX) {
+      hold->active_count++;
+    }
+  } else if (hold->active_count != 0) {
+    hold->active_count--;
+    if (hold->active_count == 0) {
+      // A hold is counted when it ends, together with its duration.
+      ticks = sl_sleeptimer_get_tick_count() - power_debug_hold_start_tick[i];
+      hold->hold_count++;
+      hold->hold_ticks += ticks;
+      if (ticks > hold->max_hold_ticks) {
+        hold->max_hold_ticks = ticks;
+      }
+    }
+  }
+}
+#endif // SLI_POWER_MANAGER_DEBUG_STATISTICS_EN
 #endif // SL_POWER_MANAGER_DEBUG
 
 #undef sli_power_manager_debug_log_em_requirement
@@ -153,6 +390,9 @@ void sli_power_manager_debug_log_em_requirement(sl_power_manager_em_t em,
 #if (SL_POWER_MANAGER_DEBUG == 1)
   if (em == SL_POWER_MANAGER_EM1) {
     power_manager_log_add_requirement(&power_manager_debug_requirement_em1, add, name);
+#if defined(SLI_POWER_MANAGER_DEBUG_STATISTICS_EN)
+    power_manager_log_hold(add, name);
+#endif
   }
 #else
   (void)em;
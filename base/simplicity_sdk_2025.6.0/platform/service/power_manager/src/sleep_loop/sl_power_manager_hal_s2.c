@@ -34,6 +34,7 @@
 #include "em_emu.h"
 #include "em_cmu.h"
 #include "sl_assert.h"
+#include "sli_clock_manager.h"
 #include "sl_power_manager.h"
 #include "sli_power_manager.h"
 #include "sli_power_manager_private.h"
@@ -364,6 +365,7 @@ void EMU_EM23PresleepHook(void)
 #endif
 
     SystemCoreClockUpdate();
+    sli_clock_manager_save_clock_tree();
   }
   // Clear HFXO IEN RDY before entering sleep to prevent HFXO HW requests from waking up the system
   HFXO0->IEN_CLR = HFXO_IEN_RDY;
@@ -414,6 +416,7 @@ void EMU_EM23PostsleepHook(void)
     // Switch SYSCLK to HFXO to measure restore time
     CMU->SYSCLKCTRL = (CMU->SYSCLKCTRL & ~_CMU_SYSCLKCTRL_CLKSEL_MASK) | cmuSelect_HFXO;
     SystemCoreClockUpdate();
+    sli_clock_manager_save_clock_tree();
 #else
     sli_hfxo_manager_begin_startup_measurement();
 
@@ -468,6 +471,7 @@ void sli_power_manager_restore_high_freq_accuracy_clk(void)
     // Switch SYSCLK to HFXO to measure restore time
     CMU->SYSCLKCTRL = (CMU->SYSCLKCTRL & ~_CMU_SYSCLKCTRL_CLKSEL_MASK) | cmuSelect_HFXO;
     SystemCoreClockUpdate();
+    sli_clock_manager_save_clock_tree();
 #else
     // Start measure HFXO restore time
     sli_hfxo_manager_begin_startup_measurement();
@@ -557,6 +561,7 @@ void sli_power_manager_restore_states(void)
   }
 
   SystemCoreClockUpdate();
+  sli_clock_manager_restore_clock_tree();
 }
 #endif
 
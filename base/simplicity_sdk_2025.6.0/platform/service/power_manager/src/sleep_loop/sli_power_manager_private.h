@@ -57,6 +57,12 @@ extern "C" {
  ******************************************************************************/
 
 #define SLI_POWER_MANAGER_EM4_ENTRY_WAIT_LOOPS 200
+
+#if (SL_POWER_MANAGER_DEBUG == 1) \
+  && defined(SL_POWER_MANAGER_DEBUG_STATISTICS) && (SL_POWER_MANAGER_DEBUG_STATISTICS == 1)
+#define SLI_POWER_MANAGER_DEBUG_STATISTICS_EN
+#endif
+
 /*******************************************************************************
  *****************************   DATA TYPES   *********************************
  ******************************************************************************/
@@ -81,6 +87,22 @@ void sli_power_manager_apply_em(sl_power_manager_em_t em);
 
 void sli_power_manager_debug_init(void);
 
+#if defined(SLI_POWER_MANAGER_DEBUG_STATISTICS_EN)
+/***************************************************************************//**
+ * Accounts a sleep period and the interrupt that ended it.
+ *
+ * @param em          Energy mode that was applied.
+ *
+ * @param start_tick  Sleeptimer tick count taken before applying it.
+ *
+ * @note Must be called with interrupts disabled, right after waking up, so
+ *       that the waking interrupt is still pending.
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_POWER_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
+void sli_power_manager_debug_log_sleep(sl_power_manager_em_t em,
+                                       uint32_t              start_tick);
+#endif
+
 #if !defined(SL_CATALOG_POWER_MANAGER_NO_DEEPSLEEP_PRESENT)
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_POWER_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
 void sli_power_manager_save_states(void);
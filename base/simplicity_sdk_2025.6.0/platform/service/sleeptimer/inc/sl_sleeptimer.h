@@ -81,7 +81,7 @@ struct sl_sleeptimer_timer_handle {
   sl_sleeptimer_timer_handle_t *next;      ///< Pointer to next element in list.
   sl_sleeptimer_timer_callback_t callback; ///< Function to call when timer expires.
   uint32_t timeout_periodic;               ///< Periodic timeout.
-  uint32_t delta;                          ///< Delay relative to previous element in list.
+  uint32_t delta;                          ///< Delay relative to previous element in list, or heap slot + 1 when the heap timer queue is used.
   uint32_t timeout_expected_tc;            ///< Expected tick count of the next timeout (only used for periodic timer).
   uint16_t conversion_error;               ///< The error when converting ms to ticks (thousandths of ticks)
   uint16_t accumulated_error;              ///< Accumulated conversion error (thousandths of ticks)
@@ -70,6 +70,28 @@
 // The difference should be null or of few ticks since the counter never stop.
 #define MIN_DIFF_BETWEEN_COUNT_AND_EXPIRATION  2
 
+#ifndef SL_SLEEPTIMER_TIMER_QUEUE_DELTA_LIST
+#define SL_SLEEPTIMER_TIMER_QUEUE_DELTA_LIST  0
+#endif
+#ifndef SL_SLEEPTIMER_TIMER_QUEUE_HEAP
+#define SL_SLEEPTIMER_TIMER_QUEUE_HEAP        1
+#endif
+#ifndef SL_SLEEPTIMER_TIMER_QUEUE
+#define SL_SLEEPTIMER_TIMER_QUEUE             SL_SLEEPTIMER_TIMER_QUEUE_DELTA_LIST
+#endif
+
+#if SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_HEAP
+#ifndef SL_SLEEPTIMER_TIMER_QUEUE_HEAP_SIZE
+#define SL_SLEEPTIMER_TIMER_QUEUE_HEAP_SIZE   32
+#endif
+#if (SL_SLEEPTIMER_TIMER_QUEUE_HEAP_SIZE < 1) || (SL_SLEEPTIMER_TIMER_QUEUE_HEAP_SIZE > 255)
+#error "SL_SLEEPTIMER_TIMER_QUEUE_HEAP_SIZE must be between 1 and 255"
+#endif
+// Depth of the stack used to walk the due part of the heap. A depth-first
+// walk never holds more than the heap height + 1 slots.
+#define TIMER_HEAP_WALK_DEPTH  16u
+#endif
+
 /// @brief Time Format.
 SLEEPTIMER_ENUM(sl_sleeptimer_time_format_t) {
   TIME_FORMAT_UNIX = 0,           ///< Number of seconds since January 1, 1970, 00:00. Type is signed, so represented on 31 bit.
@@ -100,8 +122,30 @@ static uint32_t calculated_sec_count = 0;
 // Timer frequency in Hz.
 static uint32_t timer_frequency;
 
+#if SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_HEAP
+// Timer heap entry, ordered by deadline then by insertion sequence.
+typedef struct {
+  uint64_t deadline;                    // Absolute 64 bits tick count of expiration.
+  uint32_t sequence;                    // Insertion order, keeps ties first in first out.
+  sl_sleeptimer_timer_handle_t *handle; // Running timer.
+} timer_heap_entry_t;
+
+// Running timers as a binary min-heap. The slot of a timer is kept in the
+// delta field of its handle (slot + 1, 0 when the timer is not running).
+static timer_heap_entry_t timer_heap[SL_SLEEPTIMER_TIMER_QUEUE_HEAP_SIZE];
+
+// Number of running timers.
+static uint32_t timer_heap_count;
+
+// Sequence number of the next inserted timer.
+static uint32_t timer_heap_sequence;
+
+// 64 bits tick count at last heap update.
+static volatile uint64_t timer_heap_update_count;
+#else
 // Head of timer list.
 static sl_sleeptimer_timer_handle_t *timer_head;
+#endif
 
 // Count at last update of delta of first timer.
 static volatile sl_sleeptimer_tick_count_t last_delta_update_count;
@@ -118,6 +162,32 @@ static uint32_t max_millisecond_conversion;
 // Sleep on ISR exit flag.
 static volatile bool sleep_on_isr_exit = false;
 
+#if SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_HEAP
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static sl_status_t timer_heap_insert_timer(sl_sleeptimer_timer_handle_t *handle,
+                                           sl_sleeptimer_tick_count_t timeout);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static sl_status_t timer_heap_remove_timer(sl_sleeptimer_timer_handle_t *handle);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static bool timer_heap_get_slot(const sl_sleeptimer_timer_handle_t *handle,
+                                uint32_t *slot);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+__STATIC_INLINE bool timer_heap_entry_is_before(const timer_heap_entry_t *entry,
+                                                const timer_heap_entry_t *other);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static void timer_heap_restore(uint32_t slot);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static sl_sleeptimer_timer_handle_t *timer_heap_find_due(uint64_t limit,
+                                                         uint16_t option_flags);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static void update_timer_heap(void);
+#else
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
 static void delta_list_insert_timer(sl_sleeptimer_timer_handle_t *handle,
                                     sl_sleeptimer_tick_count_t timeout);
@@ -126,10 +196,11 @@ SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
 static sl_status_t delta_list_remove_timer(sl_sleeptimer_timer_handle_t *handle);
 
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
-static sl_status_t set_comparator_for_next_timer(void);
+static void update_delta_list(void);
+#endif
 
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
-static void update_delta_list(void);
+static sl_status_t set_comparator_for_next_timer(void);
 
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
 __STATIC_INLINE uint32_t div_to_log2(uint32_t div);
@@ -192,7 +263,12 @@ sl_status_t sl_sleeptimer_init(void)
 
   CORE_ENTER_ATOMIC();
   if (!is_sleeptimer_initialized) {
+#if SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_HEAP
+    timer_heap_count = 0u;
+    timer_heap_update_count = 0u;
+#else
     timer_head  = NULL;
+#endif
     last_delta_update_count = 0u;
     overflow_counter = 0u;
     sleeptimer_hal_init_timer();
@@ -461,6 +537,16 @@ sl_status_t sl_sleeptimer_stop_timer(sl_sleeptimer_timer_handle_t *handle)
 #endif
 
   CORE_ENTER_CRITICAL();
+#if SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_HEAP
+  update_timer_heap();
+
+  // If first timer in heap, update timer comparator.
+  if ((timer_heap_count > 0u) && (timer_heap[0].handle == handle)) {
+    set_comparator = true;
+  }
+
+  error = timer_heap_remove_timer(handle);
+#else
   update_delta_list();
 
   // If first timer in list, update timer comparator.
@@ -469,6 +555,7 @@ sl_status_t sl_sleeptimer_stop_timer(sl_sleeptimer_timer_handle_t *handle)
   }
 
   error = delta_list_remove_timer(handle);
+#endif
   if (error != SL_STATUS_OK) {
     CORE_EXIT_CRITICAL();
 
@@ -493,6 +580,17 @@ sl_status_t sl_sleeptimer_is_timer_running(const sl_sleeptimer_timer_handle_t *h
                                            bool *running)
 {
   CORE_DECLARE_IRQ_STATE;
+#if SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_HEAP
+  uint32_t slot;
+
+  if (handle == NULL || running == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  } else {
+    CORE_ENTER_ATOMIC();
+    *running = timer_heap_get_slot(handle, &slot);
+    CORE_EXIT_ATOMIC();
+  }
+#else
   sl_sleeptimer_timer_handle_t *current;
 
   if (handle == NULL || running == NULL) {
@@ -510,6 +608,7 @@ sl_status_t sl_sleeptimer_is_timer_running(const sl_sleeptimer_timer_handle_t *h
     }
     CORE_EXIT_ATOMIC();
   }
+#endif
   return SL_STATUS_OK;
 }
 
@@ -520,6 +619,28 @@ sl_status_t sl_sleeptimer_get_timer_time_remaining(const sl_sleeptimer_timer_han
                                                    uint32_t *time)
 {
   CORE_DECLARE_IRQ_STATE;
+#if SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_HEAP
+  uint32_t slot;
+
+  if (handle == NULL || time == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  CORE_ENTER_ATOMIC();
+
+  update_timer_heap();
+  if (!timer_heap_get_slot(handle, &slot)) {
+    CORE_EXIT_ATOMIC();
+
+    return SL_STATUS_NOT_READY;
+  }
+
+  if (timer_heap[slot].deadline > timer_heap_update_count) {
+    *time = (uint32_t)(timer_heap[slot].deadline - timer_heap_update_count);
+  } else {
+    *time = 0;
+  }
+#else
   sl_sleeptimer_timer_handle_t *current;
 
   if (handle == NULL || time == NULL) {
@@ -550,6 +671,7 @@ sl_status_t sl_sleeptimer_get_timer_time_remaining(const sl_sleeptimer_timer_han
   } else {
     *time = 0;
   }
+#endif
 
   CORE_EXIT_ATOMIC();
 
@@ -564,6 +686,35 @@ sl_status_t sl_sleeptimer_get_remaining_time_of_first_timer(uint16_t option_flag
                                                             uint32_t *time_remaining)
 {
   CORE_DECLARE_IRQ_STATE;
+#if SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_HEAP
+  const timer_heap_entry_t *first = NULL;
+  uint64_t current_count;
+
+  CORE_ENTER_ATOMIC();
+  // Heap is not sorted, look at every timer with option flags requirement.
+  for (uint32_t slot = 0u; slot < timer_heap_count; slot++) {
+    const timer_heap_entry_t *entry = &timer_heap[slot];
+
+    if ((entry->handle->option_flags == option_flags
+         || option_flags == SL_SLEEPTIMER_ANY_FLAG)
+        && (first == NULL || timer_heap_entry_is_before(entry, first))) {
+      first = entry;
+    }
+  }
+
+  if (first != NULL) {
+    current_count = timer_heap_update_count
+                    + (sl_sleeptimer_tick_count_t)(sleeptimer_hal_get_counter() - last_delta_update_count);
+    if (first->deadline > current_count) {
+      *time_remaining = (uint32_t)(first->deadline - current_count);
+    } else {
+      *time_remaining = 0;
+    }
+    CORE_EXIT_ATOMIC();
+
+    return SL_STATUS_OK;
+  }
+#else
   sl_sleeptimer_timer_handle_t *current;
   uint32_t time = 0;
 
@@ -589,6 +740,7 @@ sl_status_t sl_sleeptimer_get_remaining_time_of_first_timer(uint16_t option_flag
     }
     current = current->next;
   }
+#endif
   CORE_EXIT_ATOMIC();
 
   return SL_STATUS_EMPTY;
@@ -611,6 +763,9 @@ sl_status_t sl_sleeptimer_get_remaining_time_of_first_timer(uint16_t option_flag
 bool sli_sleeptimer_is_power_manager_timer_next_to_expire(void)
 {
   bool next_timer_is_power_manager;
+#if SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_HEAP
+  sl_sleeptimer_timer_handle_t *timer_head = timer_heap[0].handle;
+#endif
 
   sl_atomic_load(next_timer_is_power_manager, next_timer_to_expire_is_power_manager);
 
@@ -1165,7 +1320,8 @@ void sl_sleeptimer_delay_millisecond(uint16_t time_ms)
 {
   volatile bool wait = true;
   sl_status_t error_code;
-  sl_sleeptimer_timer_handle_t delay_timer;
+  // Zeroed, so the heap queue does not have to look up a stale slot.
+  sl_sleeptimer_timer_handle_t delay_timer = { 0 };
   uint32_t delay = sl_sleeptimer_ms_to_tick(time_ms);
 
   error_code = sl_sleeptimer_start_timer(&delay_timer,
@@ -1272,7 +1428,11 @@ void process_timer_irq(uint8_t local_flag)
 #endif
     overflow_counter++;
 
+#if SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_HEAP
+    update_timer_heap();
+#else
     update_delta_list();
+#endif
 
     set_comparator_for_next_timer();
   }
@@ -1284,6 +1444,28 @@ void process_timer_irq(uint8_t local_flag)
     uint16_t option_flags = 0;
 
     CORE_ENTER_ATOMIC();
+#if SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_HEAP
+    // Make sure the timers heap is up to date with the current count
+    update_timer_heap();
+
+    // Process all timers that have expired, higher priority first.
+    current = timer_heap_find_due(timer_heap_update_count, 0u);
+    while (current != NULL) {
+      CORE_EXIT_ATOMIC();
+
+      process_expired_timer(current);
+
+      // Save current option flag and the number of timers that expired.
+      option_flags = current->option_flags;
+      nb_timer_expire++;
+
+      CORE_ENTER_ATOMIC();
+
+      // Re-update the heap to account for delays during timer's callback.
+      update_timer_heap();
+      current = timer_heap_find_due(timer_heap_update_count, 0u);
+    }
+#else
     // Make sure the timers list is up to date with the time elapsed since the last update
     update_delta_list();
 
@@ -1312,6 +1494,7 @@ void process_timer_irq(uint8_t local_flag)
       // Re-update the list to account for delays during timer's callback.
       update_delta_list();
     }
+#endif
 
     // If the only timer expired is the internal Power Manager one,
     // from the Sleeptimer perspective, the system can go back to sleep after the ISR handling.
@@ -1344,6 +1527,215 @@ static void delay_callback(sl_sleeptimer_timer_handle_t *handle,
   *wait_flag = false;
 }
 
+#if SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_HEAP
+/*******************************************************************************
+ * Inserts a timer in the heap, or reschedules it if it is already running.
+ *
+ * @param handle Pointer to handle to timer.
+ * @param timeout Timer timeout, in ticks, from the last heap update.
+ *
+ * @return 0 if successful. Error code otherwise.
+ ******************************************************************************/
+static sl_status_t timer_heap_insert_timer(sl_sleeptimer_timer_handle_t *handle,
+                                           sl_sleeptimer_tick_count_t timeout)
+{
+  sl_sleeptimer_tick_count_t local_timeout = timeout;
+  uint32_t slot;
+
+  if (!timer_heap_get_slot(handle, &slot)) {
+    if (timer_heap_count >= SL_SLEEPTIMER_TIMER_QUEUE_HEAP_SIZE) {
+      return SL_STATUS_NO_MORE_RESOURCE;
+    }
+    slot = timer_heap_count++;
+    timer_heap[slot].handle = handle;
+  }
+
+#ifdef SL_CATALOG_POWER_MANAGER_PRESENT
+  // If Power Manager is present, it's possible that a clock restore is needed right away
+  // if we are in the context of a deepsleep and the timeout value is smaller than the restore time.
+  // If it's the case, the restore will be started and the timeout value will be updated to match
+  // the restore delay.
+  if (handle->option_flags == 0) {
+    uint32_t wakeup_delay = sli_power_manager_get_restore_delay();
+
+    if (local_timeout < wakeup_delay) {
+      local_timeout = wakeup_delay;
+      sli_power_manager_initiate_restore();
+    }
+  }
+#endif
+
+  timer_heap[slot].deadline = timer_heap_update_count + local_timeout;
+  timer_heap[slot].sequence = timer_heap_sequence++;
+  timer_heap_restore(slot);
+
+  return SL_STATUS_OK;
+}
+
+/*******************************************************************************
+ * Removes a timer from heap.
+ *
+ * @param handle Pointer to handle to timer.
+ *
+ * @return 0 if successful. Error code otherwise.
+ ******************************************************************************/
+static sl_status_t timer_heap_remove_timer(sl_sleeptimer_timer_handle_t *handle)
+{
+  uint32_t slot;
+
+  if (handle == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  if (!timer_heap_get_slot(handle, &slot)) {
+    return SL_STATUS_INVALID_STATE;
+  }
+
+  handle->delta = 0u;
+  timer_heap_count--;
+
+  // Fill the hole with the last timer and move it where it belongs.
+  if (slot != timer_heap_count) {
+    timer_heap[slot] = timer_heap[timer_heap_count];
+    timer_heap_restore(slot);
+  }
+
+  return SL_STATUS_OK;
+}
+
+/*******************************************************************************
+ * Gets the heap slot of a timer.
+ *
+ * @param handle Pointer to handle to timer.
+ * @param slot Pointer to slot of timer in heap.
+ *
+ * @return true if the timer is in the heap, false otherwise.
+ ******************************************************************************/
+static bool timer_heap_get_slot(const sl_sleeptimer_timer_handle_t *handle,
+                                uint32_t *slot)
+{
+  // The delta field of a stopped or never started handle can hold anything,
+  // only trust it if the heap points back to the handle.
+  if ((handle->delta == 0u)
+      || (handle->delta > timer_heap_count)
+      || (timer_heap[handle->delta - 1u].handle != handle)) {
+    return false;
+  }
+
+  *slot = handle->delta - 1u;
+  return true;
+}
+
+/*******************************************************************************
+ * Determines if a heap entry expires before another one.
+ *
+ * @param entry Pointer to heap entry.
+ * @param other Pointer to heap entry to compare to.
+ *
+ * @return true if entry expires first, false otherwise.
+ ******************************************************************************/
+__STATIC_INLINE bool timer_heap_entry_is_before(const timer_heap_entry_t *entry,
+                                                const timer_heap_entry_t *other)
+{
+  if (entry->deadline != other->deadline) {
+    return entry->deadline < other->deadline;
+  }
+
+  // Same deadline, the timer inserted first expires first like in a delta list.
+  return (int32_t)(entry->sequence - other->sequence) < 0;
+}
+
+/*******************************************************************************
+ * Moves a heap entry up or down until heap order is restored.
+ *
+ * @param slot Slot of entry to move.
+ ******************************************************************************/
+static void timer_heap_restore(uint32_t slot)
+{
+  timer_heap_entry_t entry = timer_heap[slot];
+
+  while ((slot > 0u)
+         && timer_heap_entry_is_before(&entry, &timer_heap[(slot - 1u) / 2u])) {
+    timer_heap[slot] = timer_heap[(slot - 1u) / 2u];
+    timer_heap[slot].handle->delta = slot + 1u;
+    slot = (slot - 1u) / 2u;
+  }
+
+  while ((2u * slot) + 1u < timer_heap_count) {
+    uint32_t child = (2u * slot) + 1u;
+
+    if ((child + 1u < timer_heap_count)
+        && timer_heap_entry_is_before(&timer_heap[child + 1u], &timer_heap[child])) {
+      child++;
+    }
+    if (!timer_heap_entry_is_before(&timer_heap[child], &entry)) {
+      break;
+    }
+    timer_heap[slot] = timer_heap[child];
+    timer_heap[slot].handle->delta = slot + 1u;
+    slot = child;
+  }
+
+  timer_heap[slot] = entry;
+  timer_heap[slot].handle->delta = slot + 1u;
+}
+
+/*******************************************************************************
+ * Finds the highest priority timer among the ones expiring at or before a
+ * given tick count.
+ *
+ * @param limit 64 bits tick count.
+ * @param option_flags Only consider timers having one of these flags set.
+ *        0 to consider every timer.
+ *
+ * @return Pointer to handle to timer. NULL if none.
+ ******************************************************************************/
+static sl_sleeptimer_timer_handle_t *timer_heap_find_due(uint64_t limit,
+                                                         uint16_t option_flags)
+{
+  uint8_t walk[TIMER_HEAP_WALK_DEPTH];
+  uint32_t depth = 0u;
+  const timer_heap_entry_t *best = NULL;
+
+  if ((timer_heap_count > 0u) && (timer_heap[0].deadline <= limit)) {
+    walk[depth++] = 0u;
+  }
+
+  // The parent of a due timer is due as well, so only the due part of the
+  // heap is walked.
+  while (depth > 0u) {
+    uint32_t slot = walk[--depth];
+    const timer_heap_entry_t *entry = &timer_heap[slot];
+
+    if (((option_flags == 0u) || ((entry->handle->option_flags & option_flags) != 0u))
+        && ((best == NULL)
+            || (entry->handle->priority < best->handle->priority)
+            || ((entry->handle->priority == best->handle->priority)
+                && timer_heap_entry_is_before(entry, best)))) {
+      best = entry;
+    }
+
+    for (uint32_t child = (2u * slot) + 1u;
+         (child <= (2u * slot) + 2u) && (child < timer_heap_count);
+         child++) {
+      if (timer_heap[child].deadline <= limit) {
+        walk[depth++] = (uint8_t)child;
+      }
+    }
+  }
+
+  return (best != NULL) ? best->handle : NULL;
+}
+
+/*******************************************************************************
+ * Updates timer heap's current count.
+ ******************************************************************************/
+static void update_timer_heap(void)
+{
+  timer_heap_update_count = sl_sleeptimer_get_tick_count64();
+  last_delta_update_count = (sl_sleeptimer_tick_count_t)timer_heap_update_count;
+}
+#else
 /*******************************************************************************
  * Inserts a timer in the delta list.
  *
@@ -1441,12 +1833,30 @@ static sl_status_t delta_list_remove_timer(sl_sleeptimer_timer_handle_t *handle)
 
   return SL_STATUS_OK;
 }
+#endif
 
 /*******************************************************************************
  * Sets comparator for next timer.
  ******************************************************************************/
 static sl_status_t set_comparator_for_next_timer(void)
 {
+#if SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_HEAP
+  if (timer_heap_count > 0u) {
+    if (timer_heap[0].deadline > timer_heap_update_count) {
+      // Deadlines are less than a counter wrap away, their low 32 bits are
+      // the compare value.
+      sleeptimer_hal_enable_int(SLEEPTIMER_EVENT_COMP);
+      sleeptimer_hal_set_compare((sl_sleeptimer_tick_count_t)timer_heap[0].deadline);
+    } else {
+      // In case timer has already expire, don't attempt to set comparator. Just
+      // trigger compare match interrupt.
+      sleeptimer_hal_enable_int(SLEEPTIMER_EVENT_COMP);
+      sleeptimer_hal_set_int(SLEEPTIMER_EVENT_COMP);
+    }
+    update_next_timer_to_expire_is_power_manager();
+    return SL_STATUS_OK;
+  }
+#else
   if (timer_head) {
     if (timer_head->delta > 0) {
       sl_sleeptimer_tick_count_t compare_value;
@@ -1464,10 +1874,12 @@ static sl_status_t set_comparator_for_next_timer(void)
     update_next_timer_to_expire_is_power_manager();
     return SL_STATUS_OK;
   }
+#endif
 
   return SL_STATUS_NULL_POINTER;
 }
 
+#if SL_SLEEPTIMER_TIMER_QUEUE != SL_SLEEPTIMER_TIMER_QUEUE_HEAP
 /*******************************************************************************
  * Updates timer list's deltas.
  ******************************************************************************/
@@ -1492,6 +1904,7 @@ static void update_delta_list(void)
 
   last_delta_update_count = current_cnt;
 }
+#endif
 
 /*******************************************************************************
  * Creates and start a 32 bits timer.
@@ -1554,6 +1967,20 @@ static sl_status_t create_timer(sl_sleeptimer_timer_handle_t *handle,
 #endif
 
   CORE_ENTER_CRITICAL();
+#if SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_HEAP
+  update_timer_heap();
+  sl_status_t error = timer_heap_insert_timer(handle, timeout_initial);
+  if (error != SL_STATUS_OK) {
+    CORE_EXIT_CRITICAL();
+
+    return error;
+  }
+
+  // If first timer, update timer comparator.
+  if (timer_heap[0].handle == handle) {
+    set_comparator_for_next_timer();
+  }
+#else
   update_delta_list();
   delta_list_insert_timer(handle, timeout_initial);
 
@@ -1561,6 +1988,7 @@ static sl_status_t create_timer(sl_sleeptimer_timer_handle_t *handle,
   if (timer_head == handle) {
     set_comparator_for_next_timer();
   }
+#endif
 
   CORE_EXIT_CRITICAL();
 
@@ -1594,11 +2022,20 @@ static void process_expired_timer(sl_sleeptimer_timer_handle_t *timer)
 
   // Remove timer from list except if the timer is a periodic timer that was
   // intentionally kept at the head of the timers list.
+#if SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_HEAP
+  // Periodic timers stay in the heap and are rescheduled in place below.
+  if (skip_remove != true && timer->timeout_periodic == 0u) {
+    CORE_ENTER_ATOMIC();
+    timer_heap_remove_timer(timer);
+    CORE_EXIT_ATOMIC();
+  }
+#else
   if (skip_remove != true) {
     CORE_ENTER_ATOMIC();
     delta_list_remove_timer(timer);
     CORE_EXIT_ATOMIC();
   }
+#endif
 
   // Re-insert periodic timer that was previsouly removed from the list
   // and compensate for any deviation from the periodic timer frequency.
@@ -1618,7 +2055,11 @@ static void process_expired_timer(sl_sleeptimer_timer_handle_t *timer)
       }
     }
     CORE_ENTER_ATOMIC();
+#if SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_HEAP
+    timer_heap_insert_timer(timer, (sl_sleeptimer_tick_count_t)timeout_temp);
+#else
     delta_list_insert_timer(timer, (sl_sleeptimer_tick_count_t)timeout_temp);
+#endif
     timer->timeout_expected_tc += timer->timeout_periodic;
     CORE_EXIT_ATOMIC();
   }
@@ -1635,6 +2076,17 @@ static void process_expired_timer(sl_sleeptimer_timer_handle_t *timer)
  ******************************************************************************/
 static void update_next_timer_to_expire_is_power_manager(void)
 {
+#if SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_HEAP
+  next_timer_to_expire_is_power_manager = false;
+
+  // Look for the power manager's timer among the ones expiring at most one
+  // tick after the first timer.
+  if (timer_heap_count > 0u) {
+    next_timer_to_expire_is_power_manager =
+      (timer_heap_find_due(timer_heap[0].deadline + 1u,
+                           SLI_SLEEPTIMER_POWER_MANAGER_EARLY_WAKEUP_TIMER_FLAG) != NULL);
+  }
+#else
   sl_sleeptimer_timer_handle_t *current = timer_head;
   uint32_t delta_diff_with_first = 0;
 
@@ -1651,6 +2103,7 @@ static void update_next_timer_to_expire_is_power_manager(void)
       delta_diff_with_first += current->delta;
     }
   }
+#endif
 }
 
 /**************************************************************************//**
@@ -31,6 +31,9 @@
 #ifndef UDELAY_H
 #define UDELAY_H
 
+#include <stdint.h>
+#include "sl_status.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -41,6 +44,28 @@ extern "C" {
  * @{
  ******************************************************************************/
 
+/// Shorter delays are busy waits. The sleeptimer tick is about 30 us with a
+/// 32768 Hz oscillator and a timed wait can last up to two ticks longer, so a
+/// 10 us delay would take up to 71 us and any delay below about 60 us would
+/// more than double. From 100 us the overshoot is at most 61 %.
+#ifndef SL_UDELAY_TIMER_MIN_US
+#define SL_UDELAY_TIMER_MIN_US  100
+#endif
+
+/// Size of the sleeptimer handle storage in @ref sl_udelay_timer_t, in
+/// pointers. Checked against the sleeptimer handle when building sl_udelay.c.
+#define SL_UDELAY_TIMER_HANDLE_SIZE  8
+
+/// Callback of @ref sl_udelay_start, called from interrupt context.
+typedef void (*sl_udelay_callback_t)(void *data);
+
+/// Delay started by @ref sl_udelay_start.
+typedef struct {
+  void *handle[SL_UDELAY_TIMER_HANDLE_SIZE];  ///< Storage of the sleeptimer running the delay
+  sl_udelay_callback_t callback;              ///< Completion callback
+  void *data;                                 ///< Argument of the callback
+} sl_udelay_timer_t;
+
 /**
  * @brief
  *   Delay a number of microseconds
@@ -69,6 +94,67 @@ extern "C" {
  */
 void sl_udelay_wait(unsigned us);
 
+/**
+ * @brief
+ *   Delay a number of microseconds asleep
+ *
+ * @details
+ *   This function starts a sleeptimer and sleeps through the power manager
+ *   until it expires, in the lowest energy mode the power manager allows.
+ *   Interrupts are still served, and the power manager may return early
+ *   when another wakeup source or its sleep callbacks keep the core awake,
+ *   in which case it sleeps again. The delay lasts at least the given time
+ *   and at most two sleeptimer ticks longer, plus the wakeup time from EM2
+ *   if the power manager wakes up late.
+ *
+ *   This function falls back to @ref sl_udelay_wait for delays shorter than
+ *   SL_UDELAY_TIMER_MIN_US, in interrupt context, with interrupts disabled,
+ *   or when the timer cannot be started.
+ *
+ * @param[in] us
+ *   This is the number of microseconds to delay execution.
+ */
+void sl_udelay_sleep(unsigned us);
+
+/**
+ * @brief
+ *   Start a delay of a number of microseconds and call back on completion
+ *
+ * @details
+ *   The callback is called from the sleeptimer interrupt. Delays shorter than
+ *   SL_UDELAY_TIMER_MIN_US are busy waits, and the callback is then called
+ *   before this function returns.
+ *
+ * @param[in] timer
+ *   Delay instance, which must stay valid until the callback.
+ *
+ * @param[in] us
+ *   This is the number of microseconds to delay.
+ *
+ * @param[in] callback
+ *   Function called when the delay has elapsed.
+ *
+ * @param[in] data
+ *   Argument passed to the callback.
+ *
+ * @return
+ *   SL_STATUS_OK if the delay was started, or the sleeptimer error.
+ */
+sl_status_t sl_udelay_start(sl_udelay_timer_t *timer,
+                            unsigned us,
+                            sl_udelay_callback_t callback,
+                            void *data);
+
+/**
+ * @brief
+ *   Get the number of microseconds waited on a timer instead of a busy loop
+ *
+ * @return
+ *   Microseconds of busy waiting saved since boot by @ref sl_udelay_sleep
+ *   and @ref sl_udelay_start.
+ */
+uint32_t sl_udelay_get_saved_us(void);
+
 #ifdef __cplusplus
 }
 #endif
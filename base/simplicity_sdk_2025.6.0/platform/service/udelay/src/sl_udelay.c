@@ -30,7 +30,11 @@
 #include "sl_udelay.h"
 #include "em_device.h"
 #include "sl_assert.h"
+#include "sl_core.h"
+#include "sl_power_manager.h"
+#include "sl_sleeptimer.h"
 #include <stdbool.h>
+#include <stddef.h>
 
 /* The Cortex-M33 has a faster execution of the hw loop
  * with the same arm instructions. */
@@ -42,6 +46,35 @@
 
 void sli_delay_loop(unsigned n);
 
+_Static_assert(sizeof(sl_sleeptimer_timer_handle_t) <= sizeof(((sl_udelay_timer_t *)0)->handle),
+               "SL_UDELAY_TIMER_HANDLE_SIZE too small for the sleeptimer handle");
+
+static uint32_t udelay_saved_us = 0;
+
+// Sleeptimer ticks covering at least the given time, the first tick being
+// already partially elapsed
+static uint32_t udelay_us_to_tick(unsigned us)
+{
+  uint64_t ticks = (((uint64_t)us * sl_sleeptimer_get_timer_frequency()) + 999999U) / 1000000U;
+  return (uint32_t)ticks + 1U;
+}
+
+static void udelay_sleep_callback(sl_sleeptimer_timer_handle_t *handle, void *data)
+{
+  *(volatile bool *)data = false;
+  // Expire again every tick until sl_udelay_sleep() stops the timer. An
+  // expiry between its flag check and the power manager masking interrupts
+  // to sleep then only delays the wakeup by a tick.
+  (void)sl_sleeptimer_restart_timer(handle, 1U, udelay_sleep_callback, data, 0, 0);
+}
+
+static void udelay_start_callback(sl_sleeptimer_timer_handle_t *handle, void *data)
+{
+  (void)handle;
+  sl_udelay_timer_t *timer = (sl_udelay_timer_t *)data;
+  timer->callback(timer->data);
+}
+
 void sl_udelay_wait(unsigned us)
 {
   uint32_t freq_khz;
@@ -67,3 +100,69 @@ void sl_udelay_wait(unsigned us)
     sli_delay_loop(loops);
   }
 }
+
+void sl_udelay_sleep(unsigned us)
+{
+  volatile bool wait = true;
+  sl_sleeptimer_timer_handle_t delay_timer;
+  sl_status_t status;
+
+  if ((us < SL_UDELAY_TIMER_MIN_US) || CORE_IN_IRQ_CONTEXT() || CORE_IRQ_DISABLED()) {
+    sl_udelay_wait(us);
+    return;
+  }
+
+  status = sl_sleeptimer_start_timer(&delay_timer,
+                                     udelay_us_to_tick(us),
+                                     udelay_sleep_callback,
+                                     (void *)&wait,
+                                     0,
+                                     0);
+  if (status != SL_STATUS_OK) {
+    sl_udelay_wait(us);
+    return;
+  }
+
+  // Sleep through the power manager, which may wake up for other interrupts
+  // or return at once when its sleep callbacks keep the core awake
+  while (wait) {
+    sl_power_manager_sleep();
+  }
+  (void)sl_sleeptimer_stop_timer(&delay_timer);
+
+  CORE_ATOMIC_SECTION(udelay_saved_us += us; )
+}
+
+sl_status_t sl_udelay_start(sl_udelay_timer_t *timer,
+                            unsigned us,
+                            sl_udelay_callback_t callback,
+                            void *data)
+{
+  sl_status_t status;
+
+  EFM_ASSERT((timer != NULL) && (callback != NULL));
+  timer->callback = callback;
+  timer->data = data;
+
+  if (us < SL_UDELAY_TIMER_MIN_US) {
+    sl_udelay_wait(us);
+    callback(data);
+    return SL_STATUS_OK;
+  }
+
+  status = sl_sleeptimer_start_timer((sl_sleeptimer_timer_handle_t *)timer->handle,
+                                     udelay_us_to_tick(us),
+                                     udelay_start_callback,
+                                     (void *)timer,
+                                     0,
+                                     0);
+  if (status == SL_STATUS_OK) {
+    CORE_ATOMIC_SECTION(udelay_saved_us += us; )
+  }
+  return status;
+}
+
+uint32_t sl_udelay_get_saved_us(void)
+{
+  return udelay_saved_us;
+}
@@ -188,6 +188,11 @@ typedef struct {
     psa_key_slot_t key_slots[MBEDTLS_PSA_KEY_SLOT_COUNT];
 #endif /* MBEDTLS_PSA_KEY_STORE_DYNAMIC */
     uint8_t key_slots_initialized;
+    /* Use stamp of each entry of the persistent key cache, the entry with
+     * the lowest stamp is the least recently used one. */
+    uint32_t persistent_key_last_use[PERSISTENT_KEY_CACHE_COUNT];
+    uint32_t persistent_key_use_counter;
+    mbedtls_psa_key_slot_cache_stats_t persistent_key_cache_stats;
 } psa_global_data_t;
 
 static psa_global_data_t global_data;
@@ -326,6 +331,27 @@ static inline psa_key_slot_t *get_key_slot(size_t slice_idx, size_t slot_idx)
 
 #endif /* MBEDTLS_PSA_KEY_STORE_DYNAMIC */
 
+/** Get the index of a slot in the persistent key cache.
+ *
+ * \param[in] slot  A slot of the persistent key cache.
+ *
+ * \return The index of \p slot in the persistent key cache.
+ */
+static inline size_t persistent_key_slot_index(const psa_key_slot_t *slot)
+{
+    return (size_t) (slot - get_persistent_key_slot(0));
+}
+
+/** Record a use of an entry of the persistent key cache.
+ *
+ * \param slot_idx  The index of the entry in the persistent key cache.
+ */
+static void persistent_key_slot_touch(size_t slot_idx)
+{
+    global_data.persistent_key_last_use[slot_idx] =
+        ++global_data.persistent_key_use_counter;
+}
+
 
 
 int psa_is_valid_key_id(mbedtls_svc_key_id_t key, int vendor_ok)
@@ -415,6 +441,9 @@ static psa_status_t psa_get_and_lock_key_slot_in_memory(
         }
         status = (slot_idx < MBEDTLS_PSA_KEY_SLOT_COUNT) ?
                  PSA_SUCCESS : PSA_ERROR_DOES_NOT_EXIST;
+        if (status == PSA_SUCCESS) {
+            persistent_key_slot_touch(slot_idx);
+        }
     }
 
     if (status == PSA_SUCCESS) {
@@ -622,24 +651,30 @@ psa_status_t psa_reserve_free_key_slot(psa_key_id_t *volatile_key_id,
             break;
         }
 
-        if ((unused_persistent_key_slot == NULL) &&
-            (slot->state == PSA_SLOT_FULL) &&
+        if ((slot->state == PSA_SLOT_FULL) &&
             (!psa_key_slot_has_readers(slot)) &&
-            (!PSA_KEY_LIFETIME_IS_VOLATILE(slot->attr.lifetime))) {
+            (!PSA_KEY_LIFETIME_IS_VOLATILE(slot->attr.lifetime)) &&
+            ((unused_persistent_key_slot == NULL) ||
+             ((uint32_t) (global_data.persistent_key_last_use[slot_idx] -
+                          global_data.persistent_key_last_use[
+                              persistent_key_slot_index(unused_persistent_key_slot)])
+              > UINT32_MAX / 2))) {
+            /* Older use stamp, with wrap-around of the use counter. */
             unused_persistent_key_slot = slot;
         }
     }
 
     /*
      * If there is no unused key slot and there is at least one unlocked key
-     * slot containing the description of a persistent key, recycle the first
-     * such key slot we encountered. If we later need to operate on the
+     * slot containing the description of a persistent key, recycle the least
+     * recently used such key slot. If we later need to operate on the
      * persistent key we are evicting now, we will reload its description from
      * storage.
      */
     if ((selected_slot == NULL) &&
         (unused_persistent_key_slot != NULL)) {
         selected_slot = unused_persistent_key_slot;
+        ++global_data.persistent_key_cache_stats.evictions;
         psa_register_read(selected_slot);
         status = psa_wipe_key_slot(selected_slot);
         if (status != PSA_SUCCESS) {
@@ -821,6 +856,10 @@ psa_status_t psa_get_and_lock_key_slot(mbedtls_svc_key_id_t key,
      * thus no need to unlock the key slot here.
      */
     status = psa_get_and_lock_key_slot_in_memory(key, p_slot);
+    if ((status == PSA_SUCCESS) &&
+        !psa_key_id_is_volatile(MBEDTLS_SVC_KEY_ID_GET_KEY_ID(key))) {
+        ++global_data.persistent_key_cache_stats.hits;
+    }
     if (status != PSA_ERROR_DOES_NOT_EXIST) {
 #if defined(MBEDTLS_THREADING_C)
         PSA_THREADING_CHK_RET(mbedtls_mutex_unlock(
@@ -844,6 +883,8 @@ psa_status_t psa_get_and_lock_key_slot(mbedtls_svc_key_id_t key,
 
     (*p_slot)->attr.id = key;
     (*p_slot)->attr.lifetime = PSA_KEY_LIFETIME_PERSISTENT;
+    ++global_data.persistent_key_cache_stats.misses;
+    persistent_key_slot_touch(persistent_key_slot_index(*p_slot));
 
     status = PSA_ERROR_DOES_NOT_EXIST;
 #if defined(MBEDTLS_PSA_CRYPTO_BUILTIN_KEYS)
@@ -1128,4 +1169,9 @@ void mbedtls_psa_get_stats(mbedtls_psa_stats_t *stats)
     }
 }
 
+void mbedtls_psa_get_key_slot_cache_stats(mbedtls_psa_key_slot_cache_stats_t *stats)
+{
+    *stats = global_data.persistent_key_cache_stats;
+}
+
 #endif /* MBEDTLS_PSA_CRYPTO_C */
@@ -161,6 +161,25 @@ void psa_wipe_all_key_slots(void);
 psa_status_t psa_reserve_free_key_slot(psa_key_id_t *volatile_key_id,
                                        psa_key_slot_t **p_slot);
 
+/** Statistics of the cache of persistent keys loaded in key slots. */
+typedef struct mbedtls_psa_key_slot_cache_stats_s {
+    /** Persistent key lookups served by a loaded key slot. */
+    uint32_t hits;
+    /** Persistent key lookups which loaded the key from storage. */
+    uint32_t misses;
+    /** Loaded persistent keys evicted to make room for another key. */
+    uint32_t evictions;
+} mbedtls_psa_key_slot_cache_stats_t;
+
+/** Retrieve the statistics of the cache of persistent keys.
+ *
+ * When the key slots are full, the least recently used unlocked persistent
+ * key is evicted, so that keys used repeatedly stay loaded.
+ *
+ * \param[out] stats  On output, the cache statistics.
+ */
+void mbedtls_psa_get_key_slot_cache_stats(mbedtls_psa_key_slot_cache_stats_t *stats);
+
 #if defined(MBEDTLS_PSA_KEY_STORE_DYNAMIC)
 /** Return a key slot to the free list.
  *
@@ -0,0 +1,99 @@
+/***************************************************************************//**
+ * @file
+ * @brief Thunderboard buffered SWO log stream
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sl_iostream.h"
+#include "sl_debug_swo.h"
+#include "sl_debug_swo_config.h"
+#include "swo_stream.h"
+
+#if SL_DEBUG_SWO_BUFFER_SIZE > 0
+
+// -----------------------------------------------------------------------------
+// Configuration
+
+// ITM channel of the stream, the one SWO viewers show by default
+#define SWO_STREAM_CHANNEL              0
+// Longest line queued as one write. iostream printf writes one character at a
+// time, and every buffered write takes 2 bytes of header.
+#define SWO_STREAM_LINE_MAX             80
+
+// -----------------------------------------------------------------------------
+// Private variables
+
+static char line[SWO_STREAM_LINE_MAX];
+static size_t line_length = 0;
+
+// -----------------------------------------------------------------------------
+// Private function declarations
+
+static sl_status_t swo_stream_write(void *context, const void *buffer, size_t buffer_length);
+
+static sl_iostream_t swo_stream = {
+  .context = NULL,
+  .write = swo_stream_write,
+  .write_async = NULL,
+  .read = NULL,
+};
+
+// -----------------------------------------------------------------------------
+// Public variables
+
+sl_iostream_t *swo_stream_handle = &swo_stream;
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+// Collect the characters up to the end of the line, or as many as fit, and
+// queue them as one write. Never waits for the SWO.
+static sl_status_t swo_stream_write(void *context, const void *buffer, size_t buffer_length)
+{
+  const char *chars = (const char *)buffer;
+  sl_status_t status = SL_STATUS_OK;
+  sl_status_t sc;
+
+  (void)context;
+
+  for (size_t i = 0; i < buffer_length; i++) {
+    line[line_length++] = chars[i];
+    if ((chars[i] == '\n') || (line_length == SWO_STREAM_LINE_MAX)) {
+      sc = sl_debug_swo_write_buffered(SWO_STREAM_CHANNEL, line, line_length);
+      if (sc != SL_STATUS_OK) {
+        status = sc;
+      }
+      line_length = 0;
+    }
+  }
+  return status;
+}
+
+#endif // SL_DEBUG_SWO_BUFFER_SIZE > 0
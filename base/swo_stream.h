@@ -0,0 +1,47 @@
+/***************************************************************************//**
+ * @file
+ * @brief Thunderboard connection TX power manager
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#ifndef SWO_STREAM_H
+#define SWO_STREAM_H
+
+#include "sl_iostream.h"
+
+/***************************************************************************//**
+ * I/O stream writing to ITM channel 0 through the SWO buffer.
+ *
+ * Writes are queued with sl_debug_swo_write_buffered() a line at a time and
+ * drained by sl_debug_swo_process_action(), so logging never waits for the
+ * SWO. Lines that do not fit the buffer are dropped and counted. Only
+ * available when SL_DEBUG_SWO_BUFFER_SIZE is not 0.
+ ******************************************************************************/
+extern sl_iostream_t *swo_stream_handle;
+
+#endif // SWO_STREAM_H
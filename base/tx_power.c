@@ -0,0 +1,275 @@
+/***************************************************************************//**
+ * @file
+ * @brief Thunderboard connection TX power manager
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sl_bluetooth.h"
+#include "app_timer.h"
+#include "app_log.h"
+#include "app_assert.h"
+#include "tx_power.h"
+
+// -----------------------------------------------------------------------------
+// Configuration
+
+// RSSI sampling period of open connections
+#define TX_POWER_SAMPLE_INTERVAL_MS     1000
+// Number of RSSI samples averaged before stepping down, must be a power of 2
+#define TX_POWER_HISTORY_LEN            8
+// Link budget model. The central does not report its TX power, so it is
+// assumed to transmit at TX_POWER_PEER_ASSUMED, and the path loss is assumed
+// to be the same in both directions. The path loss is then
+// TX_POWER_PEER_ASSUMED - rssi, and the central receives us at
+// rssi + (our power - TX_POWER_PEER_ASSUMED). A central transmitting above
+// the assumption, or a weaker path towards it, leaves less margin than
+// computed; the target margin has to cover both.
+// TX power assumed for the central in 0.1 dBm
+#define TX_POWER_PEER_ASSUMED           0
+// Receiver sensitivity assumed for the central in dBm (1M PHY)
+#define TX_POWER_PEER_SENSITIVITY       (-95)
+// Link margin to hold above the peer sensitivity in dB
+#define TX_POWER_TARGET_MARGIN          15
+// Extra margin the averaged RSSI must show before stepping down in dB
+#define TX_POWER_HYSTERESIS             5
+// Step size when lowering the power in 0.1 dBm
+#define TX_POWER_STEP_DOWN              10
+// Samples to wait after any change before lowering the power again
+#define TX_POWER_HOLD_SAMPLES           4
+
+#if (TX_POWER_HISTORY_LEN & (TX_POWER_HISTORY_LEN - 1)) != 0
+#error "TX_POWER_HISTORY_LEN must be a power of 2"
+#endif
+
+// -----------------------------------------------------------------------------
+// Private types
+
+typedef struct {
+  bool used;
+  uint8_t connection;
+  int8_t rssi[TX_POWER_HISTORY_LEN]; // median RSSI samples in dBm
+  uint8_t rssi_count;                // valid samples, up to the history length
+  uint8_t rssi_next;                 // slot of the next sample
+  uint8_t hold;                      // samples left before stepping down
+  int16_t power;                     // current TX power in 0.1 dBm
+  uint32_t samples;                  // samples taken since the link opened
+  uint32_t reduction;                // sum of (max - power) per sample, 0.1 dB
+} tx_power_link_t;
+
+// -----------------------------------------------------------------------------
+// Private variables
+
+static tx_power_link_t links[SL_BT_CONFIG_MAX_CONNECTIONS];
+static uint8_t link_count = 0;
+static app_timer_t sample_timer;
+
+// -----------------------------------------------------------------------------
+// Private function declarations
+
+static tx_power_link_t *link_find(uint8_t connection);
+static void link_open(uint8_t connection);
+static void link_close(uint8_t connection);
+static void link_set_power(tx_power_link_t *link, int16_t power);
+static void link_sample(tx_power_link_t *link);
+static void sample_timer_cb(app_timer_t *timer, void *data);
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+void tx_power_on_event(sl_bt_msg_t *evt)
+{
+  tx_power_link_t *link;
+
+  switch (SL_BT_MSG_ID(evt->header)) {
+    case sl_bt_evt_connection_opened_id:
+      link_open(evt->data.evt_connection_opened.connection);
+      break;
+
+    case sl_bt_evt_connection_closed_id:
+      link_close(evt->data.evt_connection_closed.connection);
+      break;
+
+    case sl_bt_evt_connection_tx_power_id:
+      // The stack may change the power by itself, e.g. on AFH channel loss.
+      link = link_find(evt->data.evt_connection_tx_power.connection);
+      if ((link != NULL)
+          && (evt->data.evt_connection_tx_power.power_level
+              != SL_BT_CONNECTION_TX_POWER_UNAVAILABLE)) {
+        link->power = (int16_t)evt->data.evt_connection_tx_power.power_level * 10;
+        link->hold = TX_POWER_HOLD_SAMPLES;
+      }
+      break;
+
+    default:
+      break;
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+static tx_power_link_t *link_find(uint8_t connection)
+{
+  for (uint8_t i = 0; i < SL_BT_CONFIG_MAX_CONNECTIONS; i++) {
+    if (links[i].used && (links[i].connection == connection)) {
+      return &links[i];
+    }
+  }
+  return NULL;
+}
+
+static void link_open(uint8_t connection)
+{
+  sl_status_t sc;
+
+  for (uint8_t i = 0; i < SL_BT_CONFIG_MAX_CONNECTIONS; i++) {
+    if (!links[i].used) {
+      links[i] = (tx_power_link_t){
+        .used = true,
+        .connection = connection,
+        .hold = TX_POWER_HOLD_SAMPLES,
+        .power = SL_BT_CONFIG_MAX_TX_POWER,
+      };
+      // Start from the maximum so the first decisions work on a known level.
+      link_set_power(&links[i], SL_BT_CONFIG_MAX_TX_POWER);
+      if (link_count++ == 0) {
+        sc = app_timer_start(&sample_timer,
+                             TX_POWER_SAMPLE_INTERVAL_MS,
+                             sample_timer_cb,
+                             NULL,
+                             true);
+        app_assert_status(sc);
+      }
+      return;
+    }
+  }
+}
+
+static void link_close(uint8_t connection)
+{
+  sl_status_t sc;
+  tx_power_link_t *link = link_find(connection);
+
+  if (link == NULL) {
+    return;
+  }
+  if (link->samples > 0) {
+    uint32_t avg = link->reduction / link->samples;
+    app_log_info("TX power: %lu.%lu dB below maximum on average over %lu s" APP_LOG_NL,
+                 (unsigned long)(avg / 10),
+                 (unsigned long)(avg % 10),
+                 (unsigned long)(link->samples * TX_POWER_SAMPLE_INTERVAL_MS / 1000));
+  }
+  link->used = false;
+  if (--link_count == 0) {
+    sc = app_timer_stop(&sample_timer);
+    app_assert_status(sc);
+  }
+}
+
+static void link_set_power(tx_power_link_t *link, int16_t power)
+{
+  sl_status_t sc;
+  int16_t power_out;
+
+  if (power > SL_BT_CONFIG_MAX_TX_POWER) {
+    power = SL_BT_CONFIG_MAX_TX_POWER;
+  } else if (power < SL_BT_CONFIG_MIN_TX_POWER) {
+    power = SL_BT_CONFIG_MIN_TX_POWER;
+  }
+  sc = sl_bt_connection_set_tx_power(link->connection, power, &power_out);
+  if (sc != SL_STATUS_OK) {
+    app_log_status_error_f(sc, "Failed to set connection TX power" APP_LOG_NL);
+    return;
+  }
+  if (power_out != link->power) {
+    app_log_debug("TX power: connection %u at %d.%d dBm" APP_LOG_NL,
+                  link->connection,
+                  power_out / 10,
+                  (power_out < 0 ? -power_out : power_out) % 10);
+  }
+  link->power = power_out;
+}
+
+static void link_sample(tx_power_link_t *link)
+{
+  int8_t rssi;
+  int32_t sum = 0;
+  int32_t margin_now;
+  int32_t margin_avg;
+
+  if (sl_bt_connection_get_median_rssi(link->connection, &rssi) != SL_STATUS_OK) {
+    return;
+  }
+  link->rssi[link->rssi_next] = rssi;
+  link->rssi_next = (link->rssi_next + 1) & (TX_POWER_HISTORY_LEN - 1);
+  if (link->rssi_count < TX_POWER_HISTORY_LEN) {
+    link->rssi_count++;
+  }
+  for (uint8_t i = 0; i < link->rssi_count; i++) {
+    sum += link->rssi[i];
+  }
+
+  // Margin seen by the central in dB, from the latest sample to react to a
+  // fade at once and from the average to step down only on a stable link.
+  margin_now = rssi + (link->power - TX_POWER_PEER_ASSUMED) / 10
+               - TX_POWER_PEER_SENSITIVITY;
+  margin_avg = sum / link->rssi_count + (link->power - TX_POWER_PEER_ASSUMED) / 10
+               - TX_POWER_PEER_SENSITIVITY;
+
+  if (margin_now < TX_POWER_TARGET_MARGIN) {
+    // Make up the whole deficit in one go.
+    link->hold = TX_POWER_HOLD_SAMPLES;
+    link_set_power(link, link->power + (TX_POWER_TARGET_MARGIN - margin_now) * 10);
+  } else if ((link->rssi_count == TX_POWER_HISTORY_LEN)
+             && (margin_avg >= TX_POWER_TARGET_MARGIN + TX_POWER_HYSTERESIS)) {
+    if (link->hold > 0) {
+      link->hold--;
+    } else {
+      link->hold = TX_POWER_HOLD_SAMPLES;
+      link_set_power(link, link->power - TX_POWER_STEP_DOWN);
+    }
+  }
+
+  link->samples++;
+  link->reduction += (uint32_t)(SL_BT_CONFIG_MAX_TX_POWER - link->power);
+}
+
+static void sample_timer_cb(app_timer_t *timer, void *data)
+{
+  (void)timer;
+  (void)data;
+
+  for (uint8_t i = 0; i < SL_BT_CONFIG_MAX_CONNECTIONS; i++) {
+    if (links[i].used) {
+      link_sample(&links[i]);
+    }
+  }
+}
@@ -0,0 +1,48 @@
+/***************************************************************************//**
+ * @file
+ * @brief Thunderboard connection TX power manager header
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#ifndef TX_POWER_H
+#define TX_POWER_H
+
+#include "sl_bluetooth.h"
+
+/***************************************************************************//**
+ * Bluetooth stack event handler.
+ *
+ * Tracks open connections, samples their RSSI periodically and lowers the
+ * connection TX power to the least that keeps the configured link margin.
+ * The margin at the central is estimated from our RSSI, assuming a symmetric
+ * path loss and a fixed central TX power, see tx_power.c.
+ * @param[in] evt Event coming from the Bluetooth stack.
+ ******************************************************************************/
+void tx_power_on_event(sl_bt_msg_t *evt);
+
+#endif // TX_POWER_H
@@ -0,0 +1,378 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of the Automation IO button event queue
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Usage: aio_events
+//
+// Runs the Automation IO GATT service of the SDK and the firmware
+// bt_subscriptions.c with the Bluetooth stack stubbed. Button edges are
+// queued by sl_gatt_service_aio_on_change() and notified by
+// sl_gatt_service_aio_step(); the stub records each notification by
+// connection and can run a connection out of TX buffers.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "gatt_db.h"
+#include "bt_subscriptions.h"
+#include "sl_gatt_service_aio.h"
+
+// -----------------------------------------------------------------------------
+// Private macros
+
+#define HOST_CONNECTIONS        4
+#define HOST_LOG_SIZE           1024
+// TX buffers of a connection that never runs out
+#define HOST_TX_UNLIMITED       -1
+#define HOST_WRAP_ROUNDS        1000
+
+// -----------------------------------------------------------------------------
+// Private variables
+
+static uint8_t button_state;
+static uint32_t tick;
+static uint8_t next_state;
+
+// Notified values, by connection handle
+static uint8_t notified[HOST_CONNECTIONS][HOST_LOG_SIZE];
+static uint32_t notified_count[HOST_CONNECTIONS];
+static int tx_free[HOST_CONNECTIONS];
+
+// Values of the presses, in order
+static uint8_t pressed[HOST_LOG_SIZE];
+static uint32_t pressed_count;
+
+static uint32_t asserts;
+static uint32_t failures;
+
+// -----------------------------------------------------------------------------
+// Host stand-ins
+
+void aio_host_assert(sl_status_t sc)
+{
+  if (sc != SL_STATUS_OK) {
+    asserts++;
+  }
+}
+
+uint32_t sl_sleeptimer_get_tick_count(void)
+{
+  return tick;
+}
+
+uint8_t aio_digital_in_get_num(void)
+{
+  return 2;
+}
+
+uint8_t aio_digital_in_get_state(void)
+{
+  return button_state;
+}
+
+sl_status_t sl_bt_gatt_server_send_notification(uint8_t connection,
+                                                uint16_t characteristic,
+                                                size_t value_len,
+                                                const uint8_t *value)
+{
+  if ((connection >= HOST_CONNECTIONS) || (characteristic != gattdb_aio_digital_in)
+      || (value_len != 1)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (tx_free[connection] == 0) {
+    return SL_STATUS_NO_MORE_RESOURCE;
+  }
+  if (tx_free[connection] > 0) {
+    tx_free[connection]--;
+  }
+  if (notified_count[connection] < HOST_LOG_SIZE) {
+    notified[connection][notified_count[connection]] = *value;
+  }
+  notified_count[connection]++;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_gatt_server_send_user_read_response(uint8_t connection,
+                                                      uint16_t characteristic,
+                                                      uint8_t att_errorcode,
+                                                      size_t value_len,
+                                                      const uint8_t *value,
+                                                      uint16_t *sent_len)
+{
+  (void)connection;
+  (void)characteristic;
+  (void)att_errorcode;
+  (void)value_len;
+  (void)value;
+  (void)sent_len;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_gatt_server_send_user_write_response(uint8_t connection,
+                                                       uint16_t characteristic,
+                                                       uint8_t att_errorcode)
+{
+  (void)connection;
+  (void)characteristic;
+  (void)att_errorcode;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_gatt_server_write_attribute_value(uint16_t attribute,
+                                                    uint16_t offset,
+                                                    size_t value_len,
+                                                    const uint8_t *value)
+{
+  (void)attribute;
+  (void)offset;
+  (void)value_len;
+  (void)value;
+  return SL_STATUS_OK;
+}
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+static void check(const char *name, bool ok)
+{
+  printf("check %-40s %s\n", name, ok ? "ok" : "FAILED");
+  if (!ok) {
+    failures++;
+  }
+}
+
+// The subscription table sees every event before the services, like in
+// sl_bt_process_event()
+static void dispatch(sl_bt_msg_t *evt)
+{
+  bt_subscription_on_event(evt);
+  sl_gatt_service_aio_on_event(evt);
+}
+
+static void event_boot(void)
+{
+  sl_bt_msg_t evt = { .header = sl_bt_evt_system_boot_id };
+  dispatch(&evt);
+}
+
+static void event_opened(uint8_t connection)
+{
+  sl_bt_msg_t evt = { .header = sl_bt_evt_connection_opened_id };
+  evt.data.evt_connection_opened.connection = connection;
+  tx_free[connection] = HOST_TX_UNLIMITED;
+  dispatch(&evt);
+}
+
+static void event_closed(uint8_t connection)
+{
+  sl_bt_msg_t evt = { .header = sl_bt_evt_connection_closed_id };
+  evt.data.evt_connection_closed.connection = connection;
+  dispatch(&evt);
+}
+
+static void event_config(uint8_t connection, uint16_t flags)
+{
+  sl_bt_msg_t evt = { .header = sl_bt_evt_gatt_server_characteristic_status_id };
+  evt.data.evt_gatt_server_characteristic_status.connection = connection;
+  evt.data.evt_gatt_server_characteristic_status.characteristic = gattdb_aio_digital_in;
+  evt.data.evt_gatt_server_characteristic_status.status_flags = sl_bt_gatt_server_client_config;
+  evt.data.evt_gatt_server_characteristic_status.client_config_flags = flags;
+  dispatch(&evt);
+}
+
+// Button edge, each with the next of the four states
+static void press(uint32_t count)
+{
+  for (uint32_t i = 0; i < count; i++) {
+    button_state = next_state;
+    next_state = (uint8_t)((next_state + 1u) & 0x03u);
+    tick += 33u;
+    if (pressed_count < HOST_LOG_SIZE) {
+      pressed[pressed_count] = button_state;
+    }
+    pressed_count++;
+    sl_gatt_service_aio_on_change();
+  }
+}
+
+static void clear_logs(void)
+{
+  pressed_count = 0;
+  for (uint8_t i = 0; i < HOST_CONNECTIONS; i++) {
+    notified_count[i] = 0;
+  }
+}
+
+// The connection got exactly the presses first to last, in order
+static bool notified_presses(uint8_t connection, uint32_t first, uint32_t last)
+{
+  if (notified_count[connection] != last - first) {
+    return false;
+  }
+  for (uint32_t i = first; i < last; i++) {
+    if (notified[connection][i - first] != pressed[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void run_checks(void)
+{
+  uint32_t overflow;
+  bool ok = true;
+
+  event_boot();
+  event_opened(1);
+  event_config(1, sl_bt_gatt_notification);
+  check("first notification on subscribe", notified_count[1] == 1);
+
+  clear_logs();
+  press(5);
+  check("burst queued until the step", notified_count[1] == 0);
+  sl_gatt_service_aio_step();
+  check("burst notified in order", notified_presses(1, 0, 5));
+
+  clear_logs();
+  overflow = sl_gatt_service_aio_get_overflow_count();
+  press(SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE + 4);
+  sl_gatt_service_aio_step();
+  check("full queue keeps the oldest events",
+        notified_presses(1, 0, SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE));
+  check("full queue counts the dropped events",
+        sl_gatt_service_aio_get_overflow_count() - overflow == 4);
+
+  clear_logs();
+  tx_free[1] = 3;
+  press(8);
+  sl_gatt_service_aio_step();
+  check("out of TX buffers stops the step", notified_presses(1, 0, 3));
+  tx_free[1] = HOST_TX_UNLIMITED;
+  sl_gatt_service_aio_step();
+  check("next step sends the rest", notified_presses(1, 0, 8));
+
+  // The slowest subscriber holds the events it did not get yet
+  event_opened(2);
+  event_config(2, sl_bt_gatt_indication);
+  clear_logs();
+  overflow = sl_gatt_service_aio_get_overflow_count();
+  tx_free[2] = 0;
+  press(10);
+  sl_gatt_service_aio_step();
+  check("blocked subscriber does not block others",
+        notified_presses(1, 0, 10) && (notified_count[2] == 0));
+  press(10);
+  check("blocked subscriber holds the queue",
+        sl_gatt_service_aio_get_overflow_count() - overflow
+        == 20 - SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE);
+  tx_free[2] = HOST_TX_UNLIMITED;
+  sl_gatt_service_aio_step();
+  check("each subscriber gets its own events",
+        notified_presses(1, 0, SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE)
+        && notified_presses(2, 0, SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE));
+
+  // Unsubscribing or leaving frees the events only a connection held
+  clear_logs();
+  overflow = sl_gatt_service_aio_get_overflow_count();
+  tx_free[2] = 0;
+  press(SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE);
+  sl_gatt_service_aio_step();
+  event_config(2, sl_bt_gatt_disable);
+  press(SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE);
+  sl_gatt_service_aio_step();
+  check("unsubscribing frees the queue",
+        (sl_gatt_service_aio_get_overflow_count() == overflow)
+        && notified_presses(1, 0, 2 * SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE));
+  tx_free[2] = HOST_TX_UNLIMITED;
+  event_config(2, sl_bt_gatt_notification);
+  clear_logs();
+  tx_free[2] = 0;
+  press(SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE);
+  sl_gatt_service_aio_step();
+  event_closed(2);
+  press(SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE);
+  sl_gatt_service_aio_step();
+  check("closing frees the queue",
+        (sl_gatt_service_aio_get_overflow_count() == overflow)
+        && notified_presses(1, 0, 2 * SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE));
+
+  // A new subscriber starts with the events after it subscribed
+  event_opened(3);
+  clear_logs();
+  press(2);
+  event_config(3, sl_bt_gatt_notification);
+  press(3);
+  sl_gatt_service_aio_step();
+  check("new subscriber gets the later events",
+        notified_presses(1, 0, 5) && (notified_count[3] == 4)
+        && (notified[3][1] == pressed[2]) && (notified[3][3] == pressed[4]));
+  event_closed(3);
+
+  // Bursts of every length through the free running 8 bit indexes
+  clear_logs();
+  overflow = sl_gatt_service_aio_get_overflow_count();
+  for (uint32_t round = 0; round < HOST_WRAP_ROUNDS; round++) {
+    uint8_t state = next_state;
+    uint32_t count = (round % SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE) + 1u;
+    notified_count[1] = 0;
+    press(count);
+    sl_gatt_service_aio_step();
+    // Compare against this round only, the press log keeps the first ones
+    for (uint32_t i = 0; i < count; i++) {
+      ok &= notified[1][i] == (uint8_t)((state + i) & 0x03u);
+    }
+    ok &= notified_count[1] == count;
+  }
+  check("indexes wrap without loss",
+        ok && (sl_gatt_service_aio_get_overflow_count() == overflow)
+        && (pressed_count > 4u * 256u));
+
+  // Without subscribers nothing is queued, a later subscriber gets no stale
+  // events
+  event_config(1, sl_bt_gatt_disable);
+  clear_logs();
+  overflow = sl_gatt_service_aio_get_overflow_count();
+  press(2 * SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE);
+  sl_gatt_service_aio_step();
+  event_config(1, sl_bt_gatt_notification);
+  sl_gatt_service_aio_step();
+  check("nothing queued without subscribers",
+        (sl_gatt_service_aio_get_overflow_count() == overflow) && (notified_count[1] == 1));
+  event_closed(1);
+}
+
+int main(void)
+{
+  printf("queue of %u events, %u connections\n\n",
+         (unsigned int)SL_GATT_SERVICE_AIO_EVENT_QUEUE_SIZE,
+         (unsigned int)SL_BT_CONFIG_MAX_CONNECTIONS);
+  run_checks();
+  check("no failed status", asserts == 0);
+  return (failures == 0) ? 0 : 1;
+}
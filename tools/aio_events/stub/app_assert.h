@@ -0,0 +1,11 @@
+// Host stand-in, failed status checks are counted by the test
+#ifndef APP_ASSERT_H
+#define APP_ASSERT_H
+
+#include "sl_status.h"
+
+void aio_host_assert(sl_status_t sc);
+
+#define app_assert_status(sc)               aio_host_assert(sc)
+
+#endif // APP_ASSERT_H
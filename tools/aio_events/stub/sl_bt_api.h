@@ -0,0 +1,2 @@
+// Host stand-in, the Bluetooth API is in sl_bluetooth.h
+#include "sl_bluetooth.h"
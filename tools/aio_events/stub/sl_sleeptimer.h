@@ -0,0 +1,9 @@
+// Host stand-in, the tick count of the test
+#ifndef SL_SLEEPTIMER_H
+#define SL_SLEEPTIMER_H
+
+#include <stdint.h>
+
+uint32_t sl_sleeptimer_get_tick_count(void);
+
+#endif // SL_SLEEPTIMER_H
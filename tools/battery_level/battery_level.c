@@ -0,0 +1,269 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of the battery level lookup table
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Usage: battery_level
+//
+// Builds the SDK sl_power_supply.c with the project configuration and the
+// peripherals stubbed out, then compares the interpolated lookup table of
+// the battery level with the CR2032 model it is built from, for every
+// millivolt from 0 V up to the ADC full scale.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// The SDK module under test, built with the stub headers
+#include "../../base/simplicity_sdk_2025.6.0/app/bluetooth/common/power_supply/sl_power_supply.c"
+
+// -----------------------------------------------------------------------------
+// Private macros
+
+#define HOST_MAX_MV                         ADC_FULL_SCALE_MV
+#define HOST_MODEL_COUNT                    (sizeof(batt_model_cr2032) / sizeof(batt_model_cr2032[0]))
+#define HOST_MISMATCHES_SHOWN               4
+
+// -----------------------------------------------------------------------------
+// Private variables
+
+static uint32_t failures;
+static uint32_t failed_asserts;
+
+// -----------------------------------------------------------------------------
+// Host stand-ins, the peripherals of the supply probe, never started by the
+// test
+
+IADC_TypeDef battery_host_iadc;
+sl_i2cspm_t *sl_i2cspm_sensor;
+nvm3_Handle_t *nvm3_defaultHandle;
+
+void battery_host_assert(bool ok)
+{
+  if (!ok) {
+    failed_asserts++;
+  }
+}
+
+sl_status_t sl_clock_manager_enable_bus_clock(sl_bus_clock_t module)
+{
+  (void)module;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_board_enable_sensor(sl_board_sensor_t sensor)
+{
+  (void)sensor;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_si70xx_init(sl_i2cspm_t *i2cspm, uint8_t addr)
+{
+  (void)i2cspm;
+  (void)addr;
+  return SL_STATUS_OK;
+}
+
+I2C_TransferReturn_TypeDef I2CSPM_Transfer(sl_i2cspm_t *i2c, I2C_TransferSeq_TypeDef *seq)
+{
+  (void)i2c;
+  (void)seq;
+  return i2cTransferDone;
+}
+
+sl_status_t sl_sleeptimer_start_timer_ms(sl_sleeptimer_timer_handle_t *handle,
+                                         uint32_t timeout_ms,
+                                         sl_sleeptimer_timer_callback_t callback,
+                                         void *callback_data,
+                                         uint8_t priority,
+                                         uint16_t option_flags)
+{
+  (void)handle;
+  (void)timeout_ms;
+  (void)callback;
+  (void)callback_data;
+  (void)priority;
+  (void)option_flags;
+  return SL_STATUS_OK;
+}
+
+void sl_udelay_sleep(unsigned us)
+{
+  (void)us;
+}
+
+Ecode_t nvm3_readData(nvm3_Handle_t *h, nvm3_ObjectKey_t key, void *value, size_t maxLen)
+{
+  (void)h;
+  (void)key;
+  (void)value;
+  (void)maxLen;
+  return ECODE_NVM3_OK + 1U;
+}
+
+Ecode_t nvm3_writeData(nvm3_Handle_t *h, nvm3_ObjectKey_t key, const void *value, size_t len)
+{
+  (void)h;
+  (void)key;
+  (void)value;
+  (void)len;
+  return ECODE_NVM3_OK;
+}
+
+void IADC_init(IADC_TypeDef *iadc, const IADC_Init_t *init,
+               const IADC_AllConfigs_t *allConfigs)
+{
+  (void)iadc;
+  (void)init;
+  (void)allConfigs;
+}
+
+void IADC_initSingle(IADC_TypeDef *iadc, const IADC_InitSingle_t *init,
+                     const IADC_SingleInput_t *input)
+{
+  (void)iadc;
+  (void)init;
+  (void)input;
+}
+
+void IADC_command(IADC_TypeDef *iadc, IADC_Cmd_t cmd)
+{
+  (void)iadc;
+  (void)cmd;
+}
+
+void IADC_clearInt(IADC_TypeDef *iadc, uint32_t flags)
+{
+  (void)iadc;
+  (void)flags;
+}
+
+void IADC_enableInt(IADC_TypeDef *iadc, uint32_t flags)
+{
+  (void)iadc;
+  (void)flags;
+}
+
+void IADC_disableInt(IADC_TypeDef *iadc, uint32_t flags)
+{
+  (void)iadc;
+  (void)flags;
+}
+
+uint32_t IADC_getInt(IADC_TypeDef *iadc)
+{
+  (void)iadc;
+  return IADC_IF_SINGLEDONE;
+}
+
+uint32_t IADC_readSingleData(IADC_TypeDef *iadc)
+{
+  (void)iadc;
+  return 0;
+}
+
+void NVIC_ClearPendingIRQ(int irq)
+{
+  (void)irq;
+}
+
+void NVIC_EnableIRQ(int irq)
+{
+  (void)irq;
+}
+
+void NVIC_DisableIRQ(int irq)
+{
+  (void)irq;
+}
+
+void EMU_EnterEM1(void)
+{
+}
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+static void check(const char *name, bool ok)
+{
+  printf("check %-40s %s\n", name, ok ? "ok" : "FAILED");
+  if (!ok) {
+    failures++;
+  }
+}
+
+int main(void)
+{
+  uint32_t differences[3] = { 0 };
+  uint32_t mismatches = 0;
+  uint32_t table_mismatches = 0;
+  uint32_t range_mismatches = 0;
+  uint32_t decreases = 0;
+  uint8_t previous = 0;
+
+  batt_level_table_init();
+
+  for (uint32_t mv = 0; mv <= HOST_MAX_MV; mv++) {
+    uint8_t level = batt_level_lookup(mv);
+    uint8_t model = calculate_level((float)mv / 1000.0f, batt_model_cr2032,
+                                    (uint8_t)HOST_MODEL_COUNT);
+    int32_t difference = (int32_t)level - (int32_t)model;
+
+    if ((difference >= -1) && (difference <= 1)) {
+      differences[difference + 1]++;
+    } else {
+      if (mismatches < HOST_MISMATCHES_SHOWN) {
+        printf("  %u mV: level %u, %u from the model\n",
+               (unsigned int)mv, (unsigned int)level, (unsigned int)model);
+      }
+      mismatches++;
+    }
+    if ((mv <= BATT_LEVEL_MIN_MV) || (mv >= BATT_LEVEL_MAX_MV)) {
+      range_mismatches += (difference != 0) ? 1U : 0U;
+    } else if (((mv - BATT_LEVEL_MIN_MV) % BATT_LEVEL_STEP_MV) == 0U) {
+      table_mismatches += (difference != 0) ? 1U : 0U;
+    }
+    if ((mv > 0U) && (level < previous)) {
+      decreases++;
+    }
+    previous = level;
+  }
+
+  printf("%u mV values, %u table entries of %u mV\n",
+         (unsigned int)(HOST_MAX_MV + 1U), (unsigned int)BATT_LEVEL_TABLE_SIZE,
+         (unsigned int)BATT_LEVEL_STEP_MV);
+  printf("  level against the model: %u one below, %u equal, %u one above\n",
+         (unsigned int)differences[0], (unsigned int)differences[1],
+         (unsigned int)differences[2]);
+  check("lookup within one level of the model", mismatches == 0U);
+  check("lookup equals the model on table entries", table_mismatches == 0U);
+  check("lookup equals the model out of the table", range_mismatches == 0U);
+  check("lookup never falls as the voltage rises", decreases == 0U);
+  check("no failed assertion", failed_asserts == 0U);
+  return (failures == 0U) ? 0 : 1;
+}
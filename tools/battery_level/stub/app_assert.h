@@ -0,0 +1,13 @@
+// Host stand-in, failed assertions are counted by the test
+#ifndef APP_ASSERT_H
+#define APP_ASSERT_H
+
+#include <stdbool.h>
+#include "sl_status.h"
+
+void battery_host_assert(bool ok);
+
+#define app_assert(expr, ...)               battery_host_assert(expr)
+#define app_assert_status(sc)               battery_host_assert((sc) == SL_STATUS_OK)
+
+#endif // APP_ASSERT_H
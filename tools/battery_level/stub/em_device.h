@@ -0,0 +1,26 @@
+// Host stand-in, an IADC the test never starts
+#ifndef EM_DEVICE_H
+#define EM_DEVICE_H
+
+#include <stdint.h>
+
+#define IADC_PRESENT
+#define IADC_IRQn                           0
+#define _IADC_CTRL_RESETVALUE               0x00000000UL
+#define IADC_IEN_SINGLEDONE                 0x00000001UL
+#define IADC_IF_SINGLEDONE                  0x00000001UL
+
+typedef struct {
+  volatile uint32_t CTRL;
+  volatile uint32_t IEN;
+} IADC_TypeDef;
+
+extern IADC_TypeDef battery_host_iadc;
+
+#define IADC0                               (&battery_host_iadc)
+
+void NVIC_ClearPendingIRQ(int irq);
+void NVIC_EnableIRQ(int irq);
+void NVIC_DisableIRQ(int irq);
+
+#endif // EM_DEVICE_H
@@ -0,0 +1,7 @@
+// Host stand-in, an IADC the test never starts
+#ifndef EM_EMU_H
+#define EM_EMU_H
+
+void EMU_EnterEM1(void);
+
+#endif // EM_EMU_H
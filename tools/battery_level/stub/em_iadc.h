@@ -0,0 +1,48 @@
+// Host stand-in, an IADC the test never starts
+#ifndef EM_IADC_H
+#define EM_IADC_H
+
+#include <stdint.h>
+#include "em_device.h"
+
+typedef struct {
+  uint32_t unused;
+} IADC_Init_t;
+
+typedef struct {
+  uint32_t unused;
+} IADC_AllConfigs_t;
+
+typedef struct {
+  uint32_t unused;
+} IADC_InitSingle_t;
+
+typedef enum {
+  iadcPosInputAvdd
+} IADC_PosInput_t;
+
+typedef struct {
+  IADC_PosInput_t posInput;
+} IADC_SingleInput_t;
+
+typedef enum {
+  iadcCmdStartSingle
+} IADC_Cmd_t;
+
+#define IADC_INIT_DEFAULT                   { 0 }
+#define IADC_ALLCONFIGS_DEFAULT             { 0 }
+#define IADC_INITSINGLE_DEFAULT             { 0 }
+#define IADC_SINGLEINPUT_DEFAULT            { iadcPosInputAvdd }
+
+void IADC_init(IADC_TypeDef *iadc, const IADC_Init_t *init,
+               const IADC_AllConfigs_t *allConfigs);
+void IADC_initSingle(IADC_TypeDef *iadc, const IADC_InitSingle_t *init,
+                     const IADC_SingleInput_t *input);
+void IADC_command(IADC_TypeDef *iadc, IADC_Cmd_t cmd);
+void IADC_clearInt(IADC_TypeDef *iadc, uint32_t flags);
+void IADC_enableInt(IADC_TypeDef *iadc, uint32_t flags);
+void IADC_disableInt(IADC_TypeDef *iadc, uint32_t flags);
+uint32_t IADC_getInt(IADC_TypeDef *iadc);
+uint32_t IADC_readSingleData(IADC_TypeDef *iadc);
+
+#endif // EM_IADC_H
@@ -0,0 +1,19 @@
+// Host stand-in, an empty probe cache
+#ifndef NVM3_DEFAULT_H
+#define NVM3_DEFAULT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint32_t Ecode_t;
+typedef uint32_t nvm3_ObjectKey_t;
+typedef struct nvm3_Handle nvm3_Handle_t;
+
+#define ECODE_NVM3_OK                       0U
+
+extern nvm3_Handle_t *nvm3_defaultHandle;
+
+Ecode_t nvm3_readData(nvm3_Handle_t *h, nvm3_ObjectKey_t key, void *value, size_t maxLen);
+Ecode_t nvm3_writeData(nvm3_Handle_t *h, nvm3_ObjectKey_t key, const void *value, size_t len);
+
+#endif // NVM3_DEFAULT_H
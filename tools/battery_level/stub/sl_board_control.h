@@ -0,0 +1,13 @@
+// Host stand-in, the test probes no supply
+#ifndef SL_BOARD_CONTROL_H
+#define SL_BOARD_CONTROL_H
+
+#include "sl_status.h"
+
+typedef int sl_board_sensor_t;
+
+#define SL_BOARD_SENSOR_RHT                 0
+
+sl_status_t sl_board_enable_sensor(sl_board_sensor_t sensor);
+
+#endif // SL_BOARD_CONTROL_H
@@ -0,0 +1,14 @@
+// Host stand-in, the test measures no voltage
+#ifndef SL_CLOCK_MANAGER_H
+#define SL_CLOCK_MANAGER_H
+
+#include "sl_status.h"
+
+typedef int sl_bus_clock_t;
+
+#define SL_BUS_CLOCK_IADC0                  0
+#define SL_BUS_CLOCK_PRS                    1
+
+sl_status_t sl_clock_manager_enable_bus_clock(sl_bus_clock_t module);
+
+#endif // SL_CLOCK_MANAGER_H
@@ -0,0 +1,5 @@
+// Host stand-in, no power manager and no log in the test
+#ifndef SL_COMPONENT_CATALOG_H
+#define SL_COMPONENT_CATALOG_H
+
+#endif // SL_COMPONENT_CATALOG_H
@@ -0,0 +1,29 @@
+// Host stand-in, the test probes no supply
+#ifndef SL_I2CSPM_INSTANCES_H
+#define SL_I2CSPM_INSTANCES_H
+
+#include <stdint.h>
+
+#define I2C_FLAG_WRITE                      0x0001
+#define I2C_FLAG_WRITE_WRITE                0x0004
+
+typedef enum {
+  i2cTransferDone = 0
+} I2C_TransferReturn_TypeDef;
+
+typedef struct {
+  uint16_t addr;
+  uint16_t flags;
+  struct {
+    uint8_t *data;
+    uint16_t len;
+  } buf[2];
+} I2C_TransferSeq_TypeDef;
+
+typedef struct sl_i2cspm sl_i2cspm_t;
+
+extern sl_i2cspm_t *sl_i2cspm_sensor;
+
+I2C_TransferReturn_TypeDef I2CSPM_Transfer(sl_i2cspm_t *i2c, I2C_TransferSeq_TypeDef *seq);
+
+#endif // SL_I2CSPM_INSTANCES_H
@@ -0,0 +1,13 @@
+// Host stand-in, the test probes no supply
+#ifndef SL_SI70XX_H
+#define SL_SI70XX_H
+
+#include <stdint.h>
+#include "sl_status.h"
+#include "sl_i2cspm_instances.h"
+
+#define SI7021_ADDR                         0x40
+
+sl_status_t sl_si70xx_init(sl_i2cspm_t *i2cspm, uint8_t addr);
+
+#endif // SL_SI70XX_H
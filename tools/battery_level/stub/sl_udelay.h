@@ -0,0 +1,7 @@
+// Host stand-in, the test probes no supply
+#ifndef SL_UDELAY_H
+#define SL_UDELAY_H
+
+void sl_udelay_sleep(unsigned us);
+
+#endif // SL_UDELAY_H
@@ -0,0 +1,305 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of the Bluetooth event dispatch table
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Usage: bt_dispatch
+//
+// Checks the firmware bt_dispatch.c against the GATT configuration the
+// database is generated from, with the component event handlers stubbed:
+//
+// - the attribute datatypes and characteristic properties it reads from the
+//   generated gatt_db.c have the meaning it assumes,
+// - every characteristic of a component service in config/btconf is owned
+//   by that component, xml_owners.h is generated from the XML files,
+// - GATT server events reach only the owner, other events every component.
+//
+// The firmware build runs "make check" here before compiling bt_dispatch.c,
+// see base/makefile.targets.
+
+#include <stdbool.h>
+#include <stdio.h>
+
+// The firmware module under test, built with the stub headers
+#include "../../base/bt_dispatch.c"
+
+// Characteristic declaration UUID
+#define TEST_UUID_CHARACTERISTIC       0x2803
+// Attribute UUIDs at and above this index are in the 128-bit table
+#define TEST_UUID_INDEX_128            0x8000
+// Client characteristic configuration attribute datatype, see gatt_db.c
+#define TEST_DATATYPE_CONFIG           0x03
+
+typedef struct {
+  uint16_t characteristic;
+  uint8_t owner;
+} test_owner_t;
+
+// -----------------------------------------------------------------------------
+// Component handler stubs
+
+unsigned int test_asserts = 0;
+
+static unsigned int handler_calls = 0;
+static bt_dispatch_handler_t handler_last = NULL;
+static bt_dispatch_handler_t handler_order[16];
+
+#define TEST_HANDLER(name)                                   \
+  void name(sl_bt_msg_t *evt)                                \
+  {                                                          \
+    (void)evt;                                               \
+    if (handler_calls < sizeof(handler_order) / sizeof(handler_order[0])) { \
+      handler_order[handler_calls] = name;                   \
+    }                                                        \
+    handler_calls++;                                         \
+    handler_last = name;                                     \
+  }
+
+TEST_HANDLER(sl_bt_in_place_ota_dfu_on_event)
+TEST_HANDLER(sl_gatt_service_aio_on_event)
+TEST_HANDLER(sl_gatt_service_battery_on_event)
+TEST_HANDLER(sl_gatt_service_device_information_override_on_event)
+TEST_HANDLER(sl_gatt_service_hall_on_event)
+TEST_HANDLER(sl_gatt_service_imu_on_event)
+TEST_HANDLER(sl_gatt_service_light_on_event)
+TEST_HANDLER(sl_gatt_service_rht_on_event)
+
+// Handlers in the order of the generated sl_bt_process_event()
+static const bt_dispatch_handler_t test_order[] = {
+  sl_bt_in_place_ota_dfu_on_event,
+  sl_gatt_service_aio_on_event,
+  sl_gatt_service_battery_on_event,
+  sl_gatt_service_device_information_override_on_event,
+  sl_gatt_service_hall_on_event,
+  sl_gatt_service_imu_on_event,
+  sl_gatt_service_light_on_event,
+  sl_gatt_service_rht_on_event,
+};
+
+// Handler of each owner, independent of the table under test
+static const bt_dispatch_handler_t test_owner_handler[BT_DISPATCH_OWNER_COUNT] = {
+  [BT_DISPATCH_OWNER_OTA_DFU] = sl_bt_in_place_ota_dfu_on_event,
+  [BT_DISPATCH_OWNER_AIO]     = sl_gatt_service_aio_on_event,
+  [BT_DISPATCH_OWNER_BATTERY] = sl_gatt_service_battery_on_event,
+  [BT_DISPATCH_OWNER_HALL]    = sl_gatt_service_hall_on_event,
+  [BT_DISPATCH_OWNER_IMU]     = sl_gatt_service_imu_on_event,
+  [BT_DISPATCH_OWNER_LIGHT]   = sl_gatt_service_light_on_event,
+  [BT_DISPATCH_OWNER_RHT]     = sl_gatt_service_rht_on_event,
+};
+
+// Characteristics of the service of each component
+static const test_owner_t xml_owners[] = {
+#include "xml_owners.h"
+};
+
+// -----------------------------------------------------------------------------
+// Test helpers
+
+static unsigned int failures = 0;
+
+static void check(const char *name, bool ok)
+{
+  printf("check %-40s %s\n", name, ok ? "ok" : "FAIL");
+  if (!ok) {
+    failures++;
+  }
+}
+
+static void dispatch(uint32_t id, uint16_t characteristic)
+{
+  sl_bt_msg_t evt = { .header = id };
+
+  switch (id) {
+    case sl_bt_evt_gatt_server_user_read_request_id:
+      evt.data.evt_gatt_server_user_read_request.characteristic = characteristic;
+      break;
+    case sl_bt_evt_gatt_server_user_write_request_id:
+      evt.data.evt_gatt_server_user_write_request.characteristic = characteristic;
+      break;
+    case sl_bt_evt_gatt_server_characteristic_status_id:
+      evt.data.evt_gatt_server_characteristic_status.characteristic = characteristic;
+      break;
+    default:
+      break;
+  }
+  handler_calls = 0;
+  handler_last = NULL;
+  bt_dispatch_process_event(&evt);
+}
+
+static bool dispatched_to_all(void)
+{
+  if (handler_calls != sizeof(test_order) / sizeof(test_order[0])) {
+    return false;
+  }
+  for (size_t i = 0; i < sizeof(test_order) / sizeof(test_order[0]); i++) {
+    if (handler_order[i] != test_order[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static const sli_bt_gattdb_attribute_t *find_attribute(uint16_t handle)
+{
+  for (uint16_t i = 0; i < gattdb.attribute_num; i++) {
+    if (gattdb.attributes[i].handle == handle) {
+      return &gattdb.attributes[i];
+    }
+  }
+  return NULL;
+}
+
+// -----------------------------------------------------------------------------
+// Checks
+
+static void run_database_checks(void)
+{
+  bool declarations = true;
+  bool properties = true;
+  unsigned int user_values = 0;
+
+  for (uint16_t i = 0; i < gattdb.attribute_num; i++) {
+    const sli_bt_gattdb_attribute_t *attribute = &gattdb.attributes[i];
+    bool declaration = (attribute->uuid < TEST_UUID_INDEX_128)
+                       && (gattdb.uuid16[attribute->uuid] == TEST_UUID_CHARACTERISTIC);
+    bool config;
+
+    if (declaration != (attribute->datatype == BT_DISPATCH_DATATYPE_CHARACTERISTIC)) {
+      printf("attribute %u: datatype %u\n", attribute->handle, attribute->datatype);
+      declarations = false;
+    }
+    if (attribute->datatype == BT_DISPATCH_DATATYPE_USER) {
+      user_values++;
+    }
+    if (!declaration) {
+      continue;
+    }
+    // Status events come with a client configuration after the value
+    config = (i + 2 < gattdb.attribute_num)
+             && (gattdb.attributes[i + 2].datatype == TEST_DATATYPE_CONFIG);
+    if (config != ((attribute->characteristic.properties & BT_DISPATCH_PROPERTIES_STATUS) != 0)) {
+      printf("characteristic %u: properties 0x%02x\n",
+             gattdb.attributes[i + 1].handle, attribute->characteristic.properties);
+      properties = false;
+    }
+  }
+
+  check("characteristic declaration datatype", declarations);
+  check("user datatype", user_values == XML_USER_VALUES);
+  check("status event properties", properties);
+  printf("%u user type values\n\n", user_values);
+}
+
+static void run_owner_checks(void)
+{
+  bool owned = true;
+  bool listed = true;
+  bool handlers = true;
+
+  for (size_t i = 0; i < sizeof(xml_owners) / sizeof(xml_owners[0]); i++) {
+    uint16_t characteristic = xml_owners[i].characteristic;
+    if (attribute_owner[characteristic] != xml_owners[i].owner) {
+      printf("characteristic %u: owner %u, service of owner %u\n",
+             characteristic, attribute_owner[characteristic], xml_owners[i].owner);
+      owned = false;
+    }
+  }
+  for (uint16_t handle = 0; handle < BT_DISPATCH_ATTRIBUTE_COUNT; handle++) {
+    bool found = (attribute_owner[handle] == BT_DISPATCH_OWNER_NONE)
+                 || (handle == gattdb_service_changed_char);
+    for (size_t i = 0; i < sizeof(xml_owners) / sizeof(xml_owners[0]); i++) {
+      found |= (xml_owners[i].characteristic == handle);
+    }
+    if (!found) {
+      printf("characteristic %u: owner %u, in no component service\n",
+             handle, attribute_owner[handle]);
+      listed = false;
+    }
+  }
+  for (size_t owner = 0; owner < BT_DISPATCH_OWNER_COUNT; owner++) {
+    if (owner_handlers[owner] != test_owner_handler[owner]) {
+      printf("owner %u: wrong handler\n", (unsigned int)owner);
+      handlers = false;
+    }
+  }
+
+  check("characteristics owned by their service", owned);
+  check("owners in a component service", listed);
+  check("owner handlers", handlers);
+  check("stack owns Service Changed",
+        attribute_owner[gattdb_service_changed_char] == BT_DISPATCH_OWNER_STACK);
+  printf("%u characteristics in component services\n\n",
+         (unsigned int)(sizeof(xml_owners) / sizeof(xml_owners[0])));
+}
+
+static void run_dispatch_checks(void)
+{
+  static const uint32_t gatt_events[] = {
+    sl_bt_evt_gatt_server_user_read_request_id,
+    sl_bt_evt_gatt_server_user_write_request_id,
+    sl_bt_evt_gatt_server_characteristic_status_id,
+  };
+  bool routed = true;
+
+  check("not booted before the boot event", !bt_dispatch_is_booted());
+  dispatch(sl_bt_evt_system_boot_id, 0);
+  check("boot reaches every component in order", dispatched_to_all());
+  check("boot owner check passes", test_asserts == 0);
+  check("booted after the boot event", bt_dispatch_is_booted());
+
+  dispatch(sl_bt_evt_connection_opened_id, 0);
+  check("other events reach every component", dispatched_to_all());
+
+  for (size_t i = 0; i < sizeof(xml_owners) / sizeof(xml_owners[0]); i++) {
+    const sli_bt_gattdb_attribute_t *value = find_attribute(xml_owners[i].characteristic);
+    for (size_t e = 0; e < sizeof(gatt_events) / sizeof(gatt_events[0]); e++) {
+      dispatch(gatt_events[e], xml_owners[i].characteristic);
+      if ((value == NULL) || (handler_calls != 1)
+          || (handler_last != test_owner_handler[xml_owners[i].owner])) {
+        routed = false;
+      }
+    }
+  }
+  check("GATT events reach the owner only", routed);
+
+  dispatch(sl_bt_evt_gatt_server_characteristic_status_id, gattdb_service_changed_char);
+  check("Service Changed left to the stack", handler_calls == 0);
+  dispatch(sl_bt_evt_gatt_server_user_read_request_id, gattdb_device_name);
+  check("unowned characteristic dropped", handler_calls == 0);
+  dispatch(sl_bt_evt_gatt_server_user_write_request_id, BT_DISPATCH_ATTRIBUTE_COUNT);
+  check("characteristic past the table dropped", handler_calls == 0);
+}
+
+int main(void)
+{
+  run_database_checks();
+  run_owner_checks();
+  run_dispatch_checks();
+  return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,18 @@
+// Host stand-in for app_assert.h: a failed assertion is counted and printed
+// instead of stopping
+#ifndef APP_ASSERT_H
+#define APP_ASSERT_H
+
+#include <stdio.h>
+
+extern unsigned int test_asserts;
+
+#define app_assert(expr, ...)    \
+  do {                           \
+    if (!(expr)) {               \
+      test_asserts++;            \
+      printf("assert: " __VA_ARGS__); \
+    }                            \
+  } while (0)
+
+#endif // APP_ASSERT_H
@@ -0,0 +1,7 @@
+// Host stand-in for app_log.h
+#ifndef APP_LOG_H
+#define APP_LOG_H
+
+#define APP_LOG_NL    "\n"
+
+#endif // APP_LOG_H
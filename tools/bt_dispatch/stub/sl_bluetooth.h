@@ -0,0 +1,38 @@
+// Host stand-in for the parts of the Bluetooth API used by bt_dispatch.c
+#ifndef SL_BLUETOOTH_H
+#define SL_BLUETOOTH_H
+
+#include <stdint.h>
+
+#define SL_BT_MSG_ID(hdr)                      ((hdr) & 0xffff00f8)
+
+#define SL_BT_GATTDB_CHARACTERISTIC_NOTIFY     0x10
+#define SL_BT_GATTDB_CHARACTERISTIC_INDICATE   0x20
+
+enum {
+  sl_bt_evt_system_boot_id                       = 0x000100a0,
+  sl_bt_evt_connection_opened_id                 = 0x000600a0,
+  sl_bt_evt_gatt_server_user_read_request_id     = 0x010a00a0,
+  sl_bt_evt_gatt_server_user_write_request_id    = 0x080a00a0,
+  sl_bt_evt_gatt_server_characteristic_status_id = 0x030a00a0,
+};
+
+typedef struct {
+  uint32_t header;
+  union {
+    struct {
+      uint8_t connection;
+      uint16_t characteristic;
+    } evt_gatt_server_user_read_request;
+    struct {
+      uint8_t connection;
+      uint16_t characteristic;
+    } evt_gatt_server_user_write_request;
+    struct {
+      uint8_t connection;
+      uint16_t characteristic;
+    } evt_gatt_server_characteristic_status;
+  } data;
+} sl_bt_msg_t;
+
+#endif // SL_BLUETOOTH_H
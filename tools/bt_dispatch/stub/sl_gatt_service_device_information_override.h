@@ -0,0 +1,9 @@
+// Host stand-in for the component header, the test records its events
+#ifndef SL_GATT_SERVICE_DEVICE_INFORMATION_OVERRIDE_H
+#define SL_GATT_SERVICE_DEVICE_INFORMATION_OVERRIDE_H
+
+#include "sl_bluetooth.h"
+
+void sl_gatt_service_device_information_override_on_event(sl_bt_msg_t *evt);
+
+#endif // SL_GATT_SERVICE_DEVICE_INFORMATION_OVERRIDE_H
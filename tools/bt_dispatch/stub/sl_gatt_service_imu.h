@@ -0,0 +1,9 @@
+// Host stand-in for the component header, the test records its events
+#ifndef SL_GATT_SERVICE_IMU_H
+#define SL_GATT_SERVICE_IMU_H
+
+#include "sl_bluetooth.h"
+
+void sl_gatt_service_imu_on_event(sl_bt_msg_t *evt);
+
+#endif // SL_GATT_SERVICE_IMU_H
@@ -0,0 +1,299 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of the notification subscription table
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Usage: bt_subscriptions
+//
+// Replays connection and client configuration events through the firmware
+// bt_subscriptions.c, with the Bluetooth stack stubbed, and checks the table
+// against the generated GATT database: every characteristic with a client
+// configuration descriptor must have a bit in the subscription masks, except
+// the Service Changed characteristic that the stack handles itself.
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+// The firmware module under test, built with the stub headers
+#include "../../base/bt_subscriptions.c"
+
+// Client characteristic configuration attribute datatype, see gatt_db.c
+#define TEST_DATATYPE_CONFIG           0x03
+
+// Status returned by the notification stub, by connection handle
+#define TEST_CONNECTION_MAX            16
+
+// -----------------------------------------------------------------------------
+// Stack stub
+
+static sl_status_t notify_status[TEST_CONNECTION_MAX];
+static uint32_t notify_sent[TEST_CONNECTION_MAX];
+
+sl_status_t sl_bt_gatt_server_send_notification(uint8_t connection,
+                                                uint16_t characteristic,
+                                                size_t value_len,
+                                                const uint8_t *value)
+{
+  (void)characteristic;
+  (void)value_len;
+  (void)value;
+  if (notify_status[connection] == SL_STATUS_OK) {
+    notify_sent[connection]++;
+  }
+  return notify_status[connection];
+}
+
+// -----------------------------------------------------------------------------
+// Test helpers
+
+static unsigned int failures = 0;
+
+static void check(const char *name, bool ok)
+{
+  printf("check %-40s %s\n", name, ok ? "ok" : "FAIL");
+  if (!ok) {
+    failures++;
+  }
+}
+
+static void event_boot(void)
+{
+  sl_bt_msg_t evt = { .header = sl_bt_evt_system_boot_id };
+  bt_subscription_on_event(&evt);
+}
+
+static void event_opened(uint8_t connection)
+{
+  sl_bt_msg_t evt = { .header = sl_bt_evt_connection_opened_id };
+  evt.data.evt_connection_opened.connection = connection;
+  bt_subscription_on_event(&evt);
+}
+
+static void event_closed(uint8_t connection)
+{
+  sl_bt_msg_t evt = { .header = sl_bt_evt_connection_closed_id };
+  evt.data.evt_connection_closed.connection = connection;
+  bt_subscription_on_event(&evt);
+}
+
+static void event_status(uint8_t connection,
+                         uint16_t characteristic,
+                         uint8_t status_flags,
+                         uint16_t client_config_flags)
+{
+  sl_bt_msg_t evt = { .header = sl_bt_evt_gatt_server_characteristic_status_id };
+  evt.data.evt_gatt_server_characteristic_status.connection = connection;
+  evt.data.evt_gatt_server_characteristic_status.characteristic = characteristic;
+  evt.data.evt_gatt_server_characteristic_status.status_flags = status_flags;
+  evt.data.evt_gatt_server_characteristic_status.client_config_flags = client_config_flags;
+  bt_subscription_on_event(&evt);
+}
+
+static void event_config(uint8_t connection, uint16_t characteristic, uint16_t flags)
+{
+  event_status(connection, characteristic, sl_bt_gatt_server_client_config, flags);
+}
+
+static uint8_t get_flags(uint8_t connection, uint16_t characteristic)
+{
+  return bt_subscription_get(bt_subscription_find(connection), characteristic, NULL);
+}
+
+// -----------------------------------------------------------------------------
+// Checks
+
+// Every client configuration descriptor follows the value of its
+// characteristic, the bit of that value must exist and be its own.
+static void run_database_checks(void)
+{
+  bool covered = true;
+  bool unique = true;
+  bool declared = true;
+  uint32_t seen = 0;
+  unsigned int descriptors = 0;
+
+  for (uint16_t i = 1; i < gattdb.attribute_num; i++) {
+    const sli_bt_gattdb_attribute_t *config = &gattdb.attributes[i];
+    uint16_t characteristic = gattdb.attributes[i - 1].handle;
+    bt_subscription_mask_t mask;
+
+    if (config->datatype != TEST_DATATYPE_CONFIG) {
+      continue;
+    }
+    descriptors++;
+    if (characteristic == gattdb_service_changed_char) {
+      continue;
+    }
+    mask = subscription_get_mask(characteristic);
+    if (mask == 0) {
+      printf("characteristic %u has a client configuration but no bit\n", characteristic);
+      covered = false;
+    } else if (seen & mask) {
+      printf("characteristic %u shares its bit\n", characteristic);
+      unique = false;
+    }
+    seen |= mask;
+  }
+  // A bit without a descriptor is a characteristic that no longer notifies
+  for (uint16_t handle = 0; handle < sizeof(subscription_bit); handle++) {
+    bool found = false;
+    if (subscription_bit[handle] == 0) {
+      continue;
+    }
+    for (uint16_t i = 1; i < gattdb.attribute_num; i++) {
+      if ((gattdb.attributes[i].datatype == TEST_DATATYPE_CONFIG)
+          && (gattdb.attributes[i - 1].handle == handle)) {
+        found = true;
+      }
+    }
+    if (!found) {
+      printf("characteristic %u has a bit but no client configuration\n", handle);
+      declared = false;
+    }
+  }
+
+  check("notifying characteristics have a bit", covered);
+  check("bits are not shared", unique);
+  check("bits have a client configuration", declared);
+  check("bit count matches the database",
+        (seen == ((1UL << BT_SUBSCRIPTION_COUNT) - 1)) && (descriptors == BT_SUBSCRIPTION_COUNT + 1));
+  printf("%u client configurations, %u of %u mask bits used\n\n",
+         descriptors,
+         (unsigned int)BT_SUBSCRIPTION_COUNT,
+         (unsigned int)(8 * sizeof(bt_subscription_mask_t)));
+}
+
+static void run_table_checks(void)
+{
+  const uint8_t value[2] = { 0 };
+  bool ok;
+
+  check("not booted before the boot event", !bt_subscription_is_booted());
+  event_boot();
+  check("booted after the boot event", bt_subscription_is_booted());
+
+  // Fill the table and one more
+  for (uint8_t connection = 1; connection <= SL_BT_CONFIG_MAX_CONNECTIONS + 1; connection++) {
+    event_opened(connection);
+  }
+  check("table holds the connection limit",
+        bt_subscription_connection_count() == SL_BT_CONFIG_MAX_CONNECTIONS);
+  check("connection past the limit has no slot",
+        bt_subscription_find(SL_BT_CONFIG_MAX_CONNECTIONS + 1) == BT_SUBSCRIPTION_INVALID_SLOT);
+  check("new connection is not subscribed",
+        bt_subscription_count(gattdb_batt_measurement) == 0);
+
+  event_config(1, gattdb_batt_measurement, sl_bt_gatt_notification);
+  event_config(2, gattdb_batt_measurement, sl_bt_gatt_notification);
+  event_config(2, gattdb_imu_control_point, sl_bt_gatt_indication);
+  check("notification enabled",
+        (get_flags(1, gattdb_batt_measurement) == sl_bt_gatt_notification)
+        && (bt_subscription_count(gattdb_batt_measurement) == 2));
+  check("indication enabled",
+        (get_flags(2, gattdb_imu_control_point) == sl_bt_gatt_indication)
+        && (bt_subscription_count(gattdb_imu_control_point) == 1));
+  check("other characteristics unchanged",
+        (get_flags(2, gattdb_imu_acceleration) == sl_bt_gatt_disable)
+        && (get_flags(1, gattdb_imu_control_point) == sl_bt_gatt_disable));
+
+  event_config(1, gattdb_imu_orientation, sl_bt_gatt_notification | sl_bt_gatt_indication);
+  check("notification and indication together",
+        get_flags(1, gattdb_imu_orientation) == (sl_bt_gatt_notification | sl_bt_gatt_indication));
+  event_config(1, gattdb_imu_orientation, sl_bt_gatt_indication);
+  check("configuration replaces the previous one",
+        get_flags(1, gattdb_imu_orientation) == sl_bt_gatt_indication);
+
+  event_status(1, gattdb_batt_measurement, sl_bt_gatt_server_confirmation, sl_bt_gatt_disable);
+  check("confirmation keeps the configuration",
+        get_flags(1, gattdb_batt_measurement) == sl_bt_gatt_notification);
+
+  event_config(3, gattdb_es_humidity, sl_bt_gatt_notification);
+  event_config(3, gattdb_ota_control + 1, sl_bt_gatt_notification);
+  check("characteristic without a bit is ignored",
+        (get_flags(3, gattdb_es_humidity) == sl_bt_gatt_disable)
+        && (bt_subscription_count(gattdb_ota_control + 1) == 0));
+
+  ok = true;
+  for (uint16_t handle = 0; handle < sizeof(subscription_bit); handle++) {
+    if (subscription_bit[handle] != 0) {
+      event_config(4, handle, sl_bt_gatt_notification);
+    }
+  }
+  for (uint16_t handle = 0; handle < sizeof(subscription_bit); handle++) {
+    if ((subscription_bit[handle] != 0)
+        && (get_flags(4, handle) != sl_bt_gatt_notification)) {
+      ok = false;
+    }
+  }
+  check("every bit holds its own configuration", ok);
+
+  event_config(2, gattdb_batt_measurement, sl_bt_gatt_disable);
+  check("notification disabled",
+        (get_flags(2, gattdb_batt_measurement) == sl_bt_gatt_disable)
+        && (get_flags(2, gattdb_imu_control_point) == sl_bt_gatt_indication));
+
+  // Connection 1 has full TX buffers, connection 4 a failing handle
+  event_config(2, gattdb_batt_measurement, sl_bt_gatt_notification);
+  notify_status[1] = SL_STATUS_NO_MORE_RESOURCE;
+  notify_status[4] = SL_STATUS_INVALID_HANDLE;
+  check("notify all reports the first other error",
+        bt_subscription_notify_all(gattdb_batt_measurement, sizeof(value), value)
+        == SL_STATUS_INVALID_HANDLE);
+  check("notify all skips full connections only",
+        (bt_subscription_get_skipped_count() == 1) && (notify_sent[2] == 1)
+        && (notify_sent[3] == 0));
+  notify_status[4] = SL_STATUS_OK;
+  check("notify all succeeds despite full buffers",
+        bt_subscription_notify_all(gattdb_batt_measurement, sizeof(value), value)
+        == SL_STATUS_OK);
+
+  event_closed(2);
+  check("closed connection has no slot",
+        (bt_subscription_find(2) == BT_SUBSCRIPTION_INVALID_SLOT)
+        && (bt_subscription_connection_count() == SL_BT_CONFIG_MAX_CONNECTIONS - 1)
+        && (bt_subscription_count(gattdb_batt_measurement) == 2));
+  event_closed(9);
+  check("unknown connection close is ignored",
+        bt_subscription_connection_count() == SL_BT_CONFIG_MAX_CONNECTIONS - 1);
+  event_opened(5);
+  check("reused slot starts unsubscribed",
+        (bt_subscription_find(5) != BT_SUBSCRIPTION_INVALID_SLOT)
+        && (get_flags(5, gattdb_batt_measurement) == sl_bt_gatt_disable)
+        && (get_flags(5, gattdb_imu_control_point) == sl_bt_gatt_disable));
+  check("invalid slot has no configuration",
+        bt_subscription_get(BT_SUBSCRIPTION_INVALID_SLOT, gattdb_batt_measurement, NULL)
+        == sl_bt_gatt_disable);
+}
+
+int main(void)
+{
+  run_database_checks();
+  run_table_checks();
+  return (failures == 0) ? 0 : 1;
+}
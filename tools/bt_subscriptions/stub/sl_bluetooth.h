@@ -0,0 +1,54 @@
+// Host stand-in for the parts of the Bluetooth API used by bt_subscriptions.c
+#ifndef SL_BLUETOOTH_H
+#define SL_BLUETOOTH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sl_status.h"
+
+#define SL_BT_MSG_ID(hdr)                      ((hdr) & 0xffff00f8)
+
+enum {
+  sl_bt_evt_system_boot_id                      = 0x000100a0,
+  sl_bt_evt_connection_opened_id                = 0x000600a0,
+  sl_bt_evt_connection_closed_id                = 0x010600a0,
+  sl_bt_evt_gatt_server_characteristic_status_id = 0x030a00a0,
+};
+
+typedef enum {
+  sl_bt_gatt_disable      = 0x0,
+  sl_bt_gatt_notification = 0x1,
+  sl_bt_gatt_indication   = 0x2
+} sl_bt_gatt_client_config_flag_t;
+
+typedef enum {
+  sl_bt_gatt_server_client_config = 0x1,
+  sl_bt_gatt_server_confirmation  = 0x2
+} sl_bt_gatt_server_characteristic_status_flag_t;
+
+typedef struct {
+  uint32_t header;
+  union {
+    struct {
+      uint8_t connection;
+    } evt_connection_opened;
+    struct {
+      uint16_t reason;
+      uint8_t connection;
+    } evt_connection_closed;
+    struct {
+      uint8_t connection;
+      uint16_t characteristic;
+      uint8_t status_flags;
+      uint16_t client_config_flags;
+      uint16_t client_config;
+    } evt_gatt_server_characteristic_status;
+  } data;
+} sl_bt_msg_t;
+
+sl_status_t sl_bt_gatt_server_send_notification(uint8_t connection,
+                                                uint16_t characteristic,
+                                                size_t value_len,
+                                                const uint8_t *value);
+
+#endif // SL_BLUETOOTH_H
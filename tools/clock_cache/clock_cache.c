@@ -0,0 +1,600 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of the clock branch frequency cache
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Usage: clock_cache
+//
+// Runs the SDK Clock Manager and its clock branch frequency cache, the
+// series 2 HAL and emlib em_cmu.c against a host register file of the
+// EFR32BG22 clock peripherals. sl_clock_manager_init() sets the tree up from
+// the project configuration in base/config, and every register access is
+// counted. The register file applies the SET, CLR and TGL aliases on the
+// next access and models the few status bits the clock code waits for.
+//
+// The checks change the tree through each emlib and Clock Manager path that
+// can change it, and through the power manager's deepsleep clock switch,
+// comparing every cached branch frequency with an uncached HAL lookup after
+// each change. The report counts the register accesses of a lookup per
+// branch and those of the boot time queries of the project's drivers, with
+// and without the cache.
+
+#define _GNU_SOURCE
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include "em_device.h"
+#include "em_cmu.h"
+#include "em_emu.h"
+#include "em_gpio.h"
+#include "sl_clock_manager.h"
+#include "sl_clock_manager_init.h"
+#include "sli_clock_manager.h"
+#include "sli_clock_manager_hal.h"
+
+// -----------------------------------------------------------------------------
+// Private macros
+
+// Offset of the SET, CLR and TGL register aliases of series 2 peripherals
+#define HOST_ALIAS_OFFSET       0x1000U
+#define HOST_BRANCHES           ((int)SL_CLOCK_BRANCH_INVALID)
+// Status registers are read only for the device code
+#define HOST_STATUS(reg)        (*(volatile uint32_t *)&(reg))
+
+// -----------------------------------------------------------------------------
+// Private types
+
+typedef struct {
+  const char *name;
+  CMU_Clock_TypeDef clock;
+  CMU_Select_TypeDef select;
+} select_change_t;
+
+typedef struct {
+  const char *name;
+  CMU_Clock_TypeDef clock;
+  CMU_ClkDiv_TypeDef div;
+} div_change_t;
+
+typedef struct {
+  const char *name;               // driver making the query
+  sl_clock_branch_t branch;
+} boot_query_t;
+
+// -----------------------------------------------------------------------------
+// Private variables
+
+// The register file lives below 4 GiB: emlib computes the SET and CLR alias
+// addresses of a register in 32 bit integers
+static struct {
+  CMU_TypeDef cmu;
+  HFXO_TypeDef hfxo0;
+  HFRCO_TypeDef hfrco0;
+  FSRCO_TypeDef fsrco;
+  DPLL_TypeDef dpll0;
+  LFXO_TypeDef lfxo;
+  LFRCO_TypeDef lfrco;
+  ULFRCO_TypeDef ulfrco;
+  MSC_TypeDef msc;
+  EMU_TypeDef emu;
+  SYSCFG_TypeDef syscfg;
+  DEVINFO_TypeDef devinfo;
+  CoreDebug_Type core_debug;
+  SysTick_Type systick;
+} *host;
+
+static volatile void *registers[CLOCK_HOST_COUNT];
+static size_t register_sizes[CLOCK_HOST_COUNT];
+static uint32_t accesses;
+static bool hfxo_override;
+static uint32_t failures;
+
+static const char *const branch_names[HOST_BRANCHES] = {
+  [SL_CLOCK_BRANCH_SYSCLK]       = "SYSCLK",
+  [SL_CLOCK_BRANCH_HCLK]         = "HCLK",
+  [SL_CLOCK_BRANCH_HCLKRADIO]    = "HCLKRADIO",
+  [SL_CLOCK_BRANCH_PCLK]         = "PCLK",
+  [SL_CLOCK_BRANCH_LSPCLK]       = "LSPCLK",
+  [SL_CLOCK_BRANCH_TRACECLK]     = "TRACECLK",
+  [SL_CLOCK_BRANCH_ADCCLK]       = "ADCCLK",
+  [SL_CLOCK_BRANCH_EXPORTCLK]    = "EXPORTCLK",
+  [SL_CLOCK_BRANCH_EM01GRPACLK]  = "EM01GRPACLK",
+  [SL_CLOCK_BRANCH_EM01GRPBCLK]  = "EM01GRPBCLK",
+  [SL_CLOCK_BRANCH_EM01GRPCCLK]  = "EM01GRPCCLK",
+  [SL_CLOCK_BRANCH_EM01GRPDCLK]  = "EM01GRPDCLK",
+  [SL_CLOCK_BRANCH_EM23GRPACLK]  = "EM23GRPACLK",
+  [SL_CLOCK_BRANCH_EM4GRPACLK]   = "EM4GRPACLK",
+  [SL_CLOCK_BRANCH_QSPISYSCLK]   = "QSPISYSCLK",
+  [SL_CLOCK_BRANCH_IADCCLK]      = "IADCCLK",
+  [SL_CLOCK_BRANCH_WDOG0CLK]     = "WDOG0CLK",
+  [SL_CLOCK_BRANCH_WDOG1CLK]     = "WDOG1CLK",
+  [SL_CLOCK_BRANCH_RTCCCLK]      = "RTCCCLK",
+  [SL_CLOCK_BRANCH_SYSRTCCLK]    = "SYSRTCCLK",
+  [SL_CLOCK_BRANCH_EUART0CLK]    = "EUART0CLK",
+  [SL_CLOCK_BRANCH_EUSART0CLK]   = "EUSART0CLK",
+  [SL_CLOCK_BRANCH_EUSART1CLK]   = "EUSART1CLK",
+  [SL_CLOCK_BRANCH_DPLLREFCLK]   = "DPLLREFCLK",
+  [SL_CLOCK_BRANCH_I2C0CLK]      = "I2C0CLK",
+  [SL_CLOCK_BRANCH_LCDCLK]       = "LCDCLK",
+  [SL_CLOCK_BRANCH_PIXELRZCLK]   = "PIXELRZCLK",
+  [SL_CLOCK_BRANCH_PCNT0CLK]     = "PCNT0CLK",
+  [SL_CLOCK_BRANCH_PRORTCCLK]    = "PRORTCCLK",
+  [SL_CLOCK_BRANCH_SYSTICKCLK]   = "SYSTICKCLK",
+  [SL_CLOCK_BRANCH_LESENSEHFCLK] = "LESENSEHFCLK",
+  [SL_CLOCK_BRANCH_VDAC0CLK]     = "VDAC0CLK",
+  [SL_CLOCK_BRANCH_VDAC1CLK]     = "VDAC1CLK",
+  [SL_CLOCK_BRANCH_USB0CLK]      = "USB0CLK",
+  [SL_CLOCK_BRANCH_FLPLLREFCLK]  = "FLPLLREFCLK",
+  [SL_CLOCK_BRANCH_PDM0CLK]      = "PDM0CLK",
+};
+
+// Clock tree changes made through emlib, see the Clock Manager configuration
+// in base/config for the tree after init
+static const select_change_t select_changes[] = {
+  { "SYSCLK FSRCO", cmuClock_SYSCLK, cmuSelect_FSRCO },
+  { "SYSCLK HFRCODPLL", cmuClock_SYSCLK, cmuSelect_HFRCODPLL },
+  { "SYSCLK HFXO", cmuClock_SYSCLK, cmuSelect_HFXO },
+  { "EM01GRPACLK HFRCODPLL", cmuClock_EM01GRPACLK, cmuSelect_HFRCODPLL },
+  { "EM01GRPACLK FSRCO", cmuClock_EM01GRPACLK, cmuSelect_FSRCO },
+  { "EM01GRPACLK HFXO", cmuClock_EM01GRPACLK, cmuSelect_HFXO },
+  { "EM23GRPACLK LFRCO", cmuClock_EM23GRPACLK, cmuSelect_LFRCO },
+  { "EM23GRPACLK ULFRCO", cmuClock_EM23GRPACLK, cmuSelect_ULFRCO },
+  { "EM23GRPACLK LFXO", cmuClock_EM23GRPACLK, cmuSelect_LFXO },
+  { "EM4GRPACLK ULFRCO", cmuClock_EM4GRPACLK, cmuSelect_ULFRCO },
+  { "EM4GRPACLK LFXO", cmuClock_EM4GRPACLK, cmuSelect_LFXO },
+  { "RTCCCLK LFRCO", cmuClock_RTCCCLK, cmuSelect_LFRCO },
+  { "RTCCCLK LFXO", cmuClock_RTCCCLK, cmuSelect_LFXO },
+  { "WDOG0CLK HCLKDIV1024", cmuClock_WDOG0CLK, cmuSelect_HCLKDIV1024 },
+  { "WDOG0CLK LFXO", cmuClock_WDOG0CLK, cmuSelect_LFXO },
+  { "IADCCLK FSRCO", cmuClock_IADCCLK, cmuSelect_FSRCO },
+  { "IADCCLK EM01GRPACLK", cmuClock_IADCCLK, cmuSelect_EM01GRPACLK },
+  { "EUART0CLK EM23GRPACLK", cmuClock_EUART0CLK, cmuSelect_EM23GRPACLK },
+  { "EUART0CLK EM01GRPACLK", cmuClock_EUART0CLK, cmuSelect_EM01GRPACLK },
+  { "DPLLREFCLK HFXO", cmuClock_DPLLREFCLK, cmuSelect_HFXO },
+};
+
+static const div_change_t div_changes[] = {
+  { "HCLK 2", cmuClock_HCLK, 2 },
+  { "PCLK 2", cmuClock_PCLK, 2 },
+  { "HCLK 4", cmuClock_HCLK, 4 },
+  { "TRACECLK 2", cmuClock_TRACECLK, 2 },
+  { "HCLK 1", cmuClock_HCLK, 1 },
+  { "PCLK 1", cmuClock_PCLK, 1 },
+  { "TRACECLK 1", cmuClock_TRACECLK, 1 },
+};
+
+static const CMU_HFRCODPLLFreq_TypeDef bands[] = {
+  cmuHFRCODPLLFreq_1M0Hz, cmuHFRCODPLLFreq_19M0Hz, cmuHFRCODPLLFreq_38M0Hz,
+  cmuHFRCODPLLFreq_80M0Hz,
+};
+
+// Clock branch frequency queries of the project's drivers in the boot order:
+// the sleeptimer when it starts the RTCC, the SWO debug port when it sets the
+// ITM baud rate. Series 2 builds of iostream, I2CSPM and the IADC read the
+// frequency with emlib CMU_ClockFreqGet(), which the cache does not cover.
+static const boot_query_t boot_queries[] = {
+  { "sleeptimer RTCC", SL_CLOCK_BRANCH_RTCCCLK },
+  { "SWO ITM", SL_CLOCK_BRANCH_TRACECLK },
+};
+
+// -----------------------------------------------------------------------------
+// Link stubs for the parts of the device the clock code touches in passing
+
+const uint32_t SL_BUS_CLOCK_LFRCO_VALUE = 0;
+const tVectorEntry __Vectors[80];
+
+void EMU_VScaleEM01(EMU_VScaleEM01_TypeDef voltage, bool wait)
+{
+  (void)voltage;
+  (void)wait;
+}
+
+void EMU_VScaleEM01ByClock(uint32_t clockFrequency, bool wait)
+{
+  (void)clockFrequency;
+  (void)wait;
+}
+
+void GPIO_PinModeSet(GPIO_Port_TypeDef port, unsigned int pin,
+                     GPIO_Mode_TypeDef mode, unsigned int out)
+{
+  (void)port;
+  (void)pin;
+  (void)mode;
+  (void)out;
+}
+
+// -----------------------------------------------------------------------------
+// Register file
+
+// Applies the writes to the SET, CLR and TGL aliases to the registers
+static void fold_aliases(volatile uint32_t *regs, size_t size)
+{
+  // The TGL block ends with the last register of the peripheral
+  if (size < 3 * HOST_ALIAS_OFFSET) {
+    return;
+  }
+  for (size_t i = 0; i < (size - 3 * HOST_ALIAS_OFFSET) / 4; i++) {
+    volatile uint32_t *set = &regs[i + HOST_ALIAS_OFFSET / 4];
+    volatile uint32_t *clr = &regs[i + 2 * HOST_ALIAS_OFFSET / 4];
+    volatile uint32_t *tgl = &regs[i + 3 * HOST_ALIAS_OFFSET / 4];
+    regs[i] = ((regs[i] | *set) & ~*clr) ^ *tgl;
+    *set = 0;
+    *clr = 0;
+    *tgl = 0;
+  }
+}
+
+// Models the status bits the oscillator start and lock loops wait for: forced
+// crystals are ready at once, the DPLL locks as soon as it is enabled.
+static void update_status(void)
+{
+  if (host->hfxo0.CMD & HFXO_CMD_MANUALOVERRIDE) {
+    hfxo_override = true;
+    host->hfxo0.CMD = 0;
+  }
+  if (host->hfxo0.CTRL & HFXO_CTRL_FORCEEN) {
+    HOST_STATUS(host->hfxo0.STATUS) = HFXO_STATUS_RDY | HFXO_STATUS_COREBIASOPTRDY
+                                | HFXO_STATUS_ENS | (hfxo_override ? 0 : HFXO_STATUS_FSMLOCK);
+  } else {
+    HOST_STATUS(host->hfxo0.STATUS) = 0;
+    hfxo_override = false;
+  }
+  HOST_STATUS(host->lfxo.STATUS) = (host->lfxo.CTRL & LFXO_CTRL_FORCEEN)
+                             ? (LFXO_STATUS_RDY | LFXO_STATUS_ENS) : 0;
+  if (host->dpll0.EN & DPLL_EN_EN) {
+    HOST_STATUS(host->dpll0.STATUS) = DPLL_STATUS_ENS | DPLL_STATUS_RDY;
+    host->dpll0.IF |= DPLL_IF_LOCK;
+  } else {
+    HOST_STATUS(host->dpll0.STATUS) = 0;
+  }
+  HOST_STATUS(host->hfrco0.STATUS) &= ~(HFRCO_STATUS_SYNCBUSY | HFRCO_STATUS_FREQBSY);
+  HOST_STATUS(host->cmu.STATUS) |= CMU_STATUS_CALRDY;
+}
+
+static void map_registers(void)
+{
+  host = mmap(NULL, sizeof(*host), PROT_READ | PROT_WRITE,
+              MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+  if (host == MAP_FAILED) {
+    perror("mmap");
+    exit(2);
+  }
+#define MAP(id, member)                       \
+  registers[id] = &host->member;              \
+  register_sizes[id] = sizeof(host->member)
+  MAP(CLOCK_HOST_CMU, cmu);
+  MAP(CLOCK_HOST_HFXO0, hfxo0);
+  MAP(CLOCK_HOST_HFRCO0, hfrco0);
+  MAP(CLOCK_HOST_FSRCO, fsrco);
+  MAP(CLOCK_HOST_DPLL0, dpll0);
+  MAP(CLOCK_HOST_LFXO, lfxo);
+  MAP(CLOCK_HOST_LFRCO, lfrco);
+  MAP(CLOCK_HOST_ULFRCO, ulfrco);
+  MAP(CLOCK_HOST_MSC, msc);
+  MAP(CLOCK_HOST_EMU, emu);
+  MAP(CLOCK_HOST_SYSCFG, syscfg);
+  MAP(CLOCK_HOST_DEVINFO, devinfo);
+  MAP(CLOCK_HOST_CORE_DEBUG, core_debug);
+  MAP(CLOCK_HOST_SYSTICK, systick);
+#undef MAP
+}
+
+// Every peripheral register access of the clock code comes through here, see
+// stub/em_device.h
+void *clock_host_access(int peripheral)
+{
+  accesses++;
+  for (int i = 0; i < CLOCK_HOST_COUNT; i++) {
+    fold_aliases((volatile uint32_t *)registers[i], register_sizes[i]);
+  }
+  update_status();
+  return (void *)registers[peripheral];
+}
+
+// -----------------------------------------------------------------------------
+// Checks
+
+static void check(const char *name, bool ok)
+{
+  printf("check %-40s %s\n", name, ok ? "ok" : "FAILED");
+  if (!ok) {
+    failures++;
+  }
+}
+
+// Uncached frequency of a branch, or 0 for a branch the device does not have
+static uint32_t branch_frequency_uncached(sl_clock_branch_t branch)
+{
+  uint32_t frequency;
+
+  if (sli_clock_manager_hal_get_clock_branch_frequency(branch, &frequency) != SL_STATUS_OK) {
+    return 0;
+  }
+  return frequency;
+}
+
+static uint32_t branch_frequency_cached(sl_clock_branch_t branch)
+{
+  uint32_t frequency;
+
+  if (sl_clock_manager_get_clock_branch_frequency(branch, &frequency) != SL_STATUS_OK) {
+    return 0;
+  }
+  return frequency;
+}
+
+// Compares the cache with the registers for every branch, both when the
+// lookup fills the cache and when it hits
+static bool cache_matches(void)
+{
+  bool ok = true;
+
+  for (int i = 0; i < HOST_BRANCHES; i++) {
+    sl_clock_branch_t branch = (sl_clock_branch_t)i;
+    uint32_t expected = branch_frequency_uncached(branch);
+    uint32_t fill = branch_frequency_cached(branch);
+    uint32_t hit = branch_frequency_cached(branch);
+    if ((fill != expected) || (hit != expected)) {
+      printf("  %s: %lu Hz cached, %lu Hz in the registers\n", branch_names[i],
+             (unsigned long)hit, (unsigned long)expected);
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+// Fills the cache for every branch, so a missing invalidation shows up
+static void fill_cache(void)
+{
+  for (int i = 0; i < HOST_BRANCHES; i++) {
+    (void)branch_frequency_cached((sl_clock_branch_t)i);
+  }
+}
+
+static void check_select_changes(void)
+{
+  char name[64];
+
+  for (size_t i = 0; i < sizeof(select_changes) / sizeof(select_changes[0]); i++) {
+    fill_cache();
+    CMU_ClockSelectSet(select_changes[i].clock, select_changes[i].select);
+    snprintf(name, sizeof(name), "select %s", select_changes[i].name);
+    check(name, cache_matches());
+  }
+}
+
+static void check_div_changes(void)
+{
+  char name[64];
+
+  for (size_t i = 0; i < sizeof(div_changes) / sizeof(div_changes[0]); i++) {
+    fill_cache();
+    CMU_ClockDivSet(div_changes[i].clock, div_changes[i].div);
+    snprintf(name, sizeof(name), "divider %s", div_changes[i].name);
+    check(name, cache_matches());
+  }
+}
+
+static void check_band_changes(void)
+{
+  char name[64];
+
+  CMU_ClockSelectSet(cmuClock_SYSCLK, cmuSelect_HFRCODPLL);
+  CMU_ClockSelectSet(cmuClock_EM01GRPACLK, cmuSelect_HFRCODPLL);
+  for (size_t i = 0; i < sizeof(bands) / sizeof(bands[0]); i++) {
+    fill_cache();
+    CMU_HFRCODPLLBandSet(bands[i]);
+    snprintf(name, sizeof(name), "HFRCODPLL band %lu Hz", (unsigned long)bands[i]);
+    check(name, cache_matches());
+  }
+
+  fill_cache();
+  CMU_DPLLInit_TypeDef dpll = CMU_DPLL_HFXO_TO_76_8MHZ;
+  check("DPLL lock status", CMU_DPLLLock(&dpll));
+  check("DPLL lock 76.8 MHz", cache_matches());
+
+  fill_cache();
+  CMU_HFRCODPLLBandSet(cmuHFRCODPLLFreq_80M0Hz);
+  check("DPLL unlock HFRCODPLL 80 MHz", cache_matches());
+}
+
+static void check_sysclk_source(void)
+{
+  fill_cache();
+  check("Clock Manager SYSCLK FSRCO status",
+        slx_clock_manager_set_sysclk_source(SL_OSCILLATOR_FSRCO) == SL_STATUS_OK);
+  check("Clock Manager SYSCLK FSRCO", cache_matches());
+
+  fill_cache();
+  check("Clock Manager SYSCLK HFXO status",
+        slx_clock_manager_set_sysclk_source(SL_OSCILLATOR_HFXO) == SL_STATUS_OK);
+  check("Clock Manager SYSCLK HFXO", cache_matches());
+}
+
+// The power manager moves SYSCLK and EM01GRPACLK to the FSRCO before deepsleep
+// with direct register writes and restores them on wakeup, see
+// sl_power_manager_hal_s2.c
+static void check_deepsleep(void)
+{
+  uint32_t sysclkctrl;
+  uint32_t em01grpactrl;
+  uint32_t count;
+
+  fill_cache();
+  sysclkctrl = host->cmu.SYSCLKCTRL;
+  em01grpactrl = host->cmu.EM01GRPACLKCTRL;
+  CMU->SYSCLKCTRL = (host->cmu.SYSCLKCTRL & ~_CMU_SYSCLKCTRL_CLKSEL_MASK) | CMU_SYSCLKCTRL_CLKSEL_FSRCO;
+  CMU->EM01GRPACLKCTRL = (host->cmu.EM01GRPACLKCTRL & ~_CMU_EM01GRPACLKCTRL_CLKSEL_MASK)
+                         | CMU_EM01GRPACLKCTRL_CLKSEL_FSRCO;
+  SystemCoreClockUpdate();
+  sli_clock_manager_save_clock_tree();
+  check("deepsleep FSRCO switch", cache_matches());
+
+  CMU->SYSCLKCTRL = sysclkctrl;
+  CMU->EM01GRPACLKCTRL = em01grpactrl;
+  SystemCoreClockUpdate();
+  sli_clock_manager_restore_clock_tree();
+  check("deepsleep restore", cache_matches());
+
+  // The entries saved before the sleep come back without a register access
+  fill_cache();
+  sli_clock_manager_save_clock_tree();
+  sli_clock_manager_restore_clock_tree();
+  count = accesses;
+  for (int i = 0; i < HOST_BRANCHES; i++) {
+    (void)branch_frequency_cached((sl_clock_branch_t)i);
+  }
+  check("deepsleep restore keeps the entries", accesses == count);
+
+  // A change made while the switch is in effect is not undone by the restore
+  fill_cache();
+  sli_clock_manager_save_clock_tree();
+  CMU_ClockSelectSet(cmuClock_RTCCCLK, cmuSelect_LFRCO);
+  sli_clock_manager_restore_clock_tree();
+  check("emlib change during the switch", cache_matches());
+  CMU_ClockSelectSet(cmuClock_RTCCCLK, cmuSelect_LFXO);
+}
+
+// -----------------------------------------------------------------------------
+// Report
+
+// Register accesses of one lookup of each branch, uncached and from the cache
+static void report_lookups(void)
+{
+  uint32_t total = 0;
+
+  printf("\nRegister accesses of a clock branch frequency lookup\n");
+  printf("%-14s %12s %9s %9s\n", "branch", "Hz", "uncached", "cached");
+  fill_cache();
+  for (int i = 0; i < HOST_BRANCHES; i++) {
+    sl_clock_branch_t branch = (sl_clock_branch_t)i;
+    uint32_t uncached;
+    uint32_t cached;
+    uint32_t frequency;
+
+    uncached = accesses;
+    frequency = branch_frequency_uncached(branch);
+    uncached = accesses - uncached;
+    if (frequency == 0) {
+      continue;
+    }
+    cached = accesses;
+    (void)branch_frequency_cached(branch);
+    cached = accesses - cached;
+    printf("%-14s %12lu %9lu %9lu\n", branch_names[i], (unsigned long)frequency,
+           (unsigned long)uncached, (unsigned long)cached);
+    total += uncached;
+  }
+  printf("%-14s %12s %9lu %9u\n", "all", "", (unsigned long)total, 0U);
+}
+
+// Register accesses of the drivers' clock branch queries during
+// sl_main_init(), after sl_clock_manager_init() emptied the cache, and of the
+// same queries made again later, as sl_debug_swo_enable_itm() does for
+// TRACECLK
+static uint32_t boot_accesses(bool cached)
+{
+  uint32_t before = accesses;
+
+  for (size_t i = 0; i < sizeof(boot_queries) / sizeof(boot_queries[0]); i++) {
+    if (cached) {
+      (void)branch_frequency_cached(boot_queries[i].branch);
+    } else {
+      (void)branch_frequency_uncached(boot_queries[i].branch);
+    }
+  }
+  return accesses - before;
+}
+
+static void report_boot(void)
+{
+  uint32_t boot_uncached;
+  uint32_t boot_cached;
+  uint32_t again_uncached;
+  uint32_t again_cached;
+
+  sli_clock_manager_invalidate_clock_tree();
+  boot_uncached = boot_accesses(false);
+  boot_cached = boot_accesses(true);
+  again_uncached = boot_accesses(false);
+  again_cached = boot_accesses(true);
+
+  printf("\nRegister accesses of the driver queries\n");
+  for (size_t i = 0; i < sizeof(boot_queries) / sizeof(boot_queries[0]); i++) {
+    printf("  %s: %s\n", boot_queries[i].name, branch_names[boot_queries[i].branch]);
+  }
+  printf("%-22s %9s %9s %9s\n", "", "uncached", "cached", "avoided");
+  printf("%-22s %9lu %9lu %9lu\n", "sl_main_init()", (unsigned long)boot_uncached,
+         (unsigned long)boot_cached, (unsigned long)(boot_uncached - boot_cached));
+  printf("%-22s %9lu %9lu %9lu\n", "each query after", (unsigned long)again_uncached,
+         (unsigned long)again_cached, (unsigned long)(again_uncached - again_cached));
+}
+
+int main(void)
+{
+  uint32_t init_accesses;
+
+  map_registers();
+  init_accesses = accesses;
+  sl_clock_manager_init();
+  init_accesses = accesses - init_accesses;
+  SystemCoreClockUpdate();
+
+  check("init SYSCLK HFXO", branch_frequency_uncached(SL_CLOCK_BRANCH_SYSCLK) == HFXO_FREQ);
+  check("init RTCCCLK LFXO", branch_frequency_uncached(SL_CLOCK_BRANCH_RTCCCLK) == 32768);
+  check("init", cache_matches());
+  check_select_changes();
+  check_div_changes();
+  check_band_changes();
+  check_sysclk_source();
+  check_deepsleep();
+
+  // Back to the tree after init for the report
+  CMU_ClockSelectSet(cmuClock_SYSCLK, cmuSelect_HFXO);
+  CMU_ClockSelectSet(cmuClock_EM01GRPACLK, cmuSelect_HFXO);
+  CMU_ClockSelectSet(cmuClock_EM23GRPACLK, cmuSelect_LFXO);
+  CMU_ClockSelectSet(cmuClock_EM4GRPACLK, cmuSelect_LFXO);
+  CMU_ClockSelectSet(cmuClock_WDOG0CLK, cmuSelect_LFXO);
+  CMU_ClockSelectSet(cmuClock_IADCCLK, cmuSelect_EM01GRPACLK);
+  check("report tree", cache_matches());
+
+  printf("\nsl_clock_manager_init(): %lu register accesses\n", (unsigned long)init_accesses);
+  report_lookups();
+  report_boot();
+
+  return failures ? 1 : 0;
+}
+
+// The system file of the device brings SystemCoreClockUpdate() and the
+// oscillator frequency getters the HAL uses. Its TrustZone check is for the
+// target build.
+#define SL_TRUSTZONE_NONSECURE
+#include "system_efr32bg22.c"
@@ -0,0 +1,58 @@
+// Host stand-in: the EFR32BG22 device header with the clock peripherals in
+// host memory. Every access to them goes through clock_host_access(), which
+// counts it and models the few status bits the clock code waits for.
+#ifndef EM_DEVICE_H
+#define EM_DEVICE_H
+
+#include "efr32bg22c224f512im40.h"
+
+void *clock_host_access(int peripheral);
+
+enum {
+  CLOCK_HOST_CMU,
+  CLOCK_HOST_HFXO0,
+  CLOCK_HOST_HFRCO0,
+  CLOCK_HOST_FSRCO,
+  CLOCK_HOST_DPLL0,
+  CLOCK_HOST_LFXO,
+  CLOCK_HOST_LFRCO,
+  CLOCK_HOST_ULFRCO,
+  CLOCK_HOST_MSC,
+  CLOCK_HOST_EMU,
+  CLOCK_HOST_SYSCFG,
+  CLOCK_HOST_DEVINFO,
+  CLOCK_HOST_CORE_DEBUG,
+  CLOCK_HOST_SYSTICK,
+  CLOCK_HOST_COUNT
+};
+
+#undef CMU
+#undef HFXO0
+#undef HFRCO0
+#undef FSRCO
+#undef DPLL0
+#undef LFXO
+#undef LFRCO
+#undef ULFRCO
+#undef MSC
+#undef EMU
+#undef SYSCFG
+#undef DEVINFO
+#undef CoreDebug
+#undef SysTick
+#define CMU                 ((CMU_TypeDef *)clock_host_access(CLOCK_HOST_CMU))
+#define HFXO0               ((HFXO_TypeDef *)clock_host_access(CLOCK_HOST_HFXO0))
+#define HFRCO0              ((HFRCO_TypeDef *)clock_host_access(CLOCK_HOST_HFRCO0))
+#define FSRCO               ((FSRCO_TypeDef *)clock_host_access(CLOCK_HOST_FSRCO))
+#define DPLL0               ((DPLL_TypeDef *)clock_host_access(CLOCK_HOST_DPLL0))
+#define LFXO                ((LFXO_TypeDef *)clock_host_access(CLOCK_HOST_LFXO))
+#define LFRCO               ((LFRCO_TypeDef *)clock_host_access(CLOCK_HOST_LFRCO))
+#define ULFRCO              ((ULFRCO_TypeDef *)clock_host_access(CLOCK_HOST_ULFRCO))
+#define MSC                 ((MSC_TypeDef *)clock_host_access(CLOCK_HOST_MSC))
+#define EMU                 ((EMU_TypeDef *)clock_host_access(CLOCK_HOST_EMU))
+#define SYSCFG              ((SYSCFG_TypeDef *)clock_host_access(CLOCK_HOST_SYSCFG))
+#define DEVINFO             ((DEVINFO_TypeDef *)clock_host_access(CLOCK_HOST_DEVINFO))
+#define CoreDebug           ((CoreDebug_Type *)clock_host_access(CLOCK_HOST_CORE_DEBUG))
+#define SysTick             ((SysTick_Type *)clock_host_access(CLOCK_HOST_SYSTICK))
+
+#endif // EM_DEVICE_H
@@ -0,0 +1,8 @@
+// Host stand-in, the components of the project catalog the clock code checks
+#ifndef SL_COMPONENT_CATALOG_H
+#define SL_COMPONENT_CATALOG_H
+
+#define SL_CATALOG_CLOCK_MANAGER_PRESENT
+#define SL_CATALOG_GPIO_PRESENT
+
+#endif // SL_COMPONENT_CATALOG_H
@@ -0,0 +1,342 @@
+/***************************************************************************//**
+ * @file
+ * @brief Replay Thunderboard energy traces against a current model
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Usage: energy_replay <model> <trace>...
+//
+// A trace is a VCOM log of a build with ENERGY_ESTIMATOR_ENABLE set. Lines
+// without "EE_TRACE" are skipped, so the raw capture can be used as is. Each
+// "EE_TRACE state" line holds the time spent in each energy mode while one
+// set of loads, advertising sets and connections was active. The charge of
+// a state is that time multiplied by the mode current plus the load
+// currents, and the radio charge per event multiplied by the number of
+// events in the state.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// -----------------------------------------------------------------------------
+// Private macros
+
+#define EM_COUNT            4
+#define LOAD_COUNT          4
+#define LINE_MAX            512
+#define LABEL_MAX           32
+// Advertising and connection interval units in ms
+#define ADV_UNIT_MS         0.625
+#define CONN_UNIT_MS        1.25
+
+// -----------------------------------------------------------------------------
+// Private types
+
+typedef struct {
+  double battery_mah;
+  double em_na[EM_COUNT];
+  double load_na[LOAD_COUNT];
+  double adv_event_nc;
+  double beacon_event_nc;
+  double conn_event_nc;
+} model_t;
+
+typedef struct {
+  char label[LABEL_MAX];
+  double em_ms[EM_COUNT];
+  double lost_ms;
+  double charge_nc;
+} period_t;
+
+// -----------------------------------------------------------------------------
+// Private variables
+
+static const char *em_keys[EM_COUNT] = {
+  "em0_na", "em1_na", "em2_na", "em3_na"
+};
+static const char *load_keys[LOAD_COUNT] = {
+  "sensor_supply_na", "si70xx_na", "si1133_na", "led_na"
+};
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+// Read "key = value" lines, '#' starts a comment. Every key must be set.
+static int model_load(const char *path, model_t *model)
+{
+  FILE *f = fopen(path, "r");
+  char line[LINE_MAX];
+  char key[64];
+  double value;
+  unsigned int seen = 0;
+  const unsigned int all = (1u << (EM_COUNT + LOAD_COUNT + 4)) - 1;
+
+  if (f == NULL) {
+    perror(path);
+    return -1;
+  }
+  while (fgets(line, sizeof(line), f) != NULL) {
+    char *comment = strchr(line, '#');
+    if (comment != NULL) {
+      *comment = '\0';
+    }
+    if (sscanf(line, " %63[a-z0-9_] = %lf", key, &value) != 2) {
+      continue;
+    }
+    for (int i = 0; i < EM_COUNT; i++) {
+      if (strcmp(key, em_keys[i]) == 0) {
+        model->em_na[i] = value;
+        seen |= 1u << i;
+      }
+    }
+    for (int i = 0; i < LOAD_COUNT; i++) {
+      if (strcmp(key, load_keys[i]) == 0) {
+        model->load_na[i] = value;
+        seen |= 1u << (EM_COUNT + i);
+      }
+    }
+    if (strcmp(key, "adv_event_nc") == 0) {
+      model->adv_event_nc = value;
+      seen |= 1u << (EM_COUNT + LOAD_COUNT);
+    } else if (strcmp(key, "beacon_event_nc") == 0) {
+      model->beacon_event_nc = value;
+      seen |= 1u << (EM_COUNT + LOAD_COUNT + 1);
+    } else if (strcmp(key, "conn_event_nc") == 0) {
+      model->conn_event_nc = value;
+      seen |= 1u << (EM_COUNT + LOAD_COUNT + 2);
+    } else if (strcmp(key, "battery_mah") == 0) {
+      model->battery_mah = value;
+      seen |= 1u << (EM_COUNT + LOAD_COUNT + 3);
+    }
+  }
+  fclose(f);
+  if (seen != all) {
+    fprintf(stderr, "%s: incomplete model\n", path);
+    return -1;
+  }
+  return 0;
+}
+
+// Parse a comma separated list of numbers, return how many were read.
+static int parse_list(const char *s, double *values, int max)
+{
+  int count = 0;
+  char *end;
+
+  while (count < max) {
+    values[count++] = strtod(s, &end);
+    if ((end == s) || (*end != ',')) {
+      break;
+    }
+    s = end + 1;
+  }
+  return count;
+}
+
+// Charge one "EE_TRACE state" line to the period.
+static int replay_state(const char *line, const model_t *model, period_t *period)
+{
+  const char *em = strstr(line, "em=");
+  const char *load = strstr(line, "load=");
+  const char *adv = strstr(line, "adv=");
+  const char *conn = strstr(line, "conn=");
+  double em_ms[EM_COUNT] = { 0 };
+  double load_count[LOAD_COUNT] = { 0 };
+  double total_ms = 0.0;
+  double load_na = 0.0;
+  double radio_na = 0.0;
+  char *end;
+
+  if ((em == NULL) || (load == NULL) || (adv == NULL) || (conn == NULL)) {
+    return -1;
+  }
+  parse_list(em + 3, em_ms, EM_COUNT);
+  parse_list(load + 5, load_count, LOAD_COUNT);
+  for (int i = 0; i < LOAD_COUNT; i++) {
+    load_na += load_count[i] * model->load_na[i];
+  }
+
+  // adv=<interval>:<connectable>,... in 0.625 ms units, 0 if stopped
+  adv += 4;
+  while (1) {
+    double interval = strtod(adv, &end);
+    if ((end == adv) || (*end != ':')) {
+      break;
+    }
+    adv = end + 1;
+    double connectable = strtod(adv, &end);
+    if (interval > 0.0) {
+      radio_na += ((connectable != 0.0) ? model->adv_event_nc : model->beacon_event_nc)
+                  * 1000.0 / (interval * ADV_UNIT_MS);
+    }
+    if (*end != ',') {
+      break;
+    }
+    adv = end + 1;
+  }
+
+  // conn=<interval>,... in 1.25 ms units, 0 if closed
+  conn += 5;
+  while (1) {
+    double interval = strtod(conn, &end);
+    if (end == conn) {
+      break;
+    }
+    if (interval > 0.0) {
+      radio_na += model->conn_event_nc * 1000.0 / (interval * CONN_UNIT_MS);
+    }
+    if (*end != ',') {
+      break;
+    }
+    conn = end + 1;
+  }
+
+  // nA * ms = pC
+  for (int i = 0; i < EM_COUNT; i++) {
+    period->em_ms[i] += em_ms[i];
+    period->charge_nc += em_ms[i] * (model->em_na[i] + load_na) / 1000.0;
+    total_ms += em_ms[i];
+  }
+  period->charge_nc += total_ms * radio_na / 1000.0;
+  return 0;
+}
+
+static double period_ms(const period_t *period)
+{
+  double ms = 0.0;
+
+  for (int i = 0; i < EM_COUNT; i++) {
+    ms += period->em_ms[i];
+  }
+  return ms;
+}
+
+static void period_report(const period_t *period, const model_t *model)
+{
+  double ms = period_ms(period);
+  double average_na;
+
+  if (ms <= 0.0) {
+    printf("%-12s no traced time\n", period->label);
+    return;
+  }
+  average_na = period->charge_nc * 1000.0 / ms;
+  // mAh * 1e6 / nA gives hours
+  printf("%-12s %9.1f s  %9.2f uA  %8.1f days  EM0 %5.2f%%  EM1 %5.2f%%  EM2 %6.2f%%  EM3 %5.2f%%",
+         period->label,
+         ms / 1000.0,
+         average_na / 1000.0,
+         model->battery_mah * 1e6 / average_na / 24.0,
+         100.0 * period->em_ms[0] / ms,
+         100.0 * period->em_ms[1] / ms,
+         100.0 * period->em_ms[2] / ms,
+         100.0 * period->em_ms[3] / ms);
+  if (period->lost_ms > 0.0) {
+    printf("  (%.1f s not traced)", period->lost_ms / 1000.0);
+  }
+  printf("\n");
+}
+
+static void period_add(period_t *total, const period_t *period)
+{
+  for (int i = 0; i < EM_COUNT; i++) {
+    total->em_ms[i] += period->em_ms[i];
+  }
+  total->lost_ms += period->lost_ms;
+  total->charge_nc += period->charge_nc;
+}
+
+static int replay_file(const char *path, const model_t *model, period_t *total)
+{
+  FILE *f = fopen(path, "r");
+  char line[LINE_MAX];
+  period_t period;
+  int in_period = 0;
+  int line_number = 0;
+
+  if (f == NULL) {
+    perror(path);
+    return -1;
+  }
+  while (fgets(line, sizeof(line), f) != NULL) {
+    const char *trace = strstr(line, "EE_TRACE ");
+    line_number++;
+    if (trace == NULL) {
+      continue;
+    }
+    trace += strlen("EE_TRACE ");
+    if (strncmp(trace, "begin ", 6) == 0) {
+      memset(&period, 0, sizeof(period));
+      sscanf(trace + 6, "%31s", period.label);
+      in_period = 1;
+    } else if (!in_period) {
+      // A capture may start in the middle of a period
+      continue;
+    } else if (strncmp(trace, "state ", 6) == 0) {
+      if (replay_state(trace, model, &period) != 0) {
+        fprintf(stderr, "%s:%d: malformed state\n", path, line_number);
+      }
+    } else if (strncmp(trace, "end", 3) == 0) {
+      const char *lost = strstr(trace, "lost=");
+      if (lost != NULL) {
+        period.lost_ms = strtod(lost + 5, NULL);
+      }
+      period_report(&period, model);
+      period_add(total, &period);
+      in_period = 0;
+    }
+  }
+  fclose(f);
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Main
+
+int main(int argc, char *argv[])
+{
+  model_t model;
+  period_t total;
+  int status = EXIT_SUCCESS;
+
+  if (argc < 3) {
+    fprintf(stderr, "Usage: %s <model> <trace>...\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  if (model_load(argv[1], &model) != 0) {
+    return EXIT_FAILURE;
+  }
+  memset(&total, 0, sizeof(total));
+  strcpy(total.label, "total");
+  for (int i = 2; i < argc; i++) {
+    if (replay_file(argv[i], &model, &total) != 0) {
+      status = EXIT_FAILURE;
+    }
+  }
+  period_report(&total, &model);
+  return status;
+}
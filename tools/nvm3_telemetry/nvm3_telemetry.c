@@ -0,0 +1,381 @@
+/***************************************************************************//**
+ * @file
+ * @brief NVM3 telemetry on a file-backed flash image
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Usage: nvm3_telemetry [-w <writes>] <image>
+//
+// Opens the SDK NVM3, built with NVM3_TELEMETRY, on a flash image file the
+// size of the default instance of the project, through a HAL that keeps the
+// image in memory with the erase and programming rules of flash. A missing
+// image is created erased. The tool optionally replays a write mix over the
+// key map of nvm3_telemetry_config.h, repacking like the application when
+// NVM3 asks for it, then draws the telemetry of the session, the erase count
+// of every page and the objects stored per key range, and writes the image
+// back. An image read from a device shows its page wear and key ranges, and
+// sessions run on the same image add up like the life of a device.
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "nvm3.h"
+#include "nvm3_default_config.h"
+#include "nvm3_telemetry_config.h"
+
+// -----------------------------------------------------------------------------
+// Private macros
+
+#define HOST_PAGES                          (NVM3_DEFAULT_NVM_SIZE / FLASH_PAGE_SIZE)
+#define HOST_BAR_WIDTH                      40
+#define HOST_KEYS_MAX                       1024
+// Keys of the write mix outside the key map, counted as other keys
+#define HOST_KEY_OTHER                      0x90000U
+
+// -----------------------------------------------------------------------------
+// Private types
+
+// One key range of the write mix: keys, object sizes and share of the writes
+typedef struct {
+  const char *name;
+  nvm3_ObjectKey_t key_min;
+  nvm3_ObjectKey_t key_max;
+  uint32_t mix_keys;
+  uint32_t mix_size_min;
+  uint32_t mix_size_max;
+  uint32_t mix_percent;
+} host_range_t;
+
+// -----------------------------------------------------------------------------
+// Private variables
+
+// Indexed by nvm3_TelemetryKeyRange_t. The mix is a guess of a connected
+// device: bonding and GATT data of the stack, application settings, a few
+// PSA keys and some other writes.
+static const host_range_t ranges[NVM3_TELEMETRY_KEY_RANGE_COUNT] = {
+  { "user", NVM3_TELEMETRY_KEY_USER_MIN, NVM3_TELEMETRY_KEY_USER_MAX, 16, 4, 32, 25 },
+  { "bluetooth", NVM3_TELEMETRY_KEY_BLUETOOTH_MIN, NVM3_TELEMETRY_KEY_BLUETOOTH_MAX, 32, 16, 64, 60 },
+  { "psa its", NVM3_TELEMETRY_KEY_PSA_ITS_MIN, NVM3_TELEMETRY_KEY_PSA_ITS_MAX, 8, 32, 128, 10 },
+  { "other", HOST_KEY_OTHER, HOST_KEY_OTHER + 3U, 4, 8, 8, 5 },
+};
+
+// The image, page aligned like the instance in flash
+static uint32_t flash[NVM3_DEFAULT_NVM_SIZE / sizeof(uint32_t)] __attribute__((aligned(FLASH_PAGE_SIZE)));
+static nvm3_CacheEntry_t cache[NVM3_DEFAULT_CACHE_SIZE];
+static nvm3_Handle_t handle;
+static nvm3_ObjectKey_t keys[HOST_KEYS_MAX];
+static uint32_t random_state = 1;
+
+// -----------------------------------------------------------------------------
+// Host stand-ins, a flash HAL on the image: an erase sets every bit of the
+// page, programming only clears bits
+
+static sl_status_t host_hal_open(nvm3_HalPtr_t nvmAdr, size_t nvmSize)
+{
+  (void)nvmAdr;
+  (void)nvmSize;
+  return SL_STATUS_OK;
+}
+
+static void host_hal_close(void)
+{
+}
+
+static sl_status_t host_hal_get_info(nvm3_HalInfo_t *info)
+{
+  info->deviceFamilyPartNumber = 0;
+  info->writeSize = NVM3_HAL_WRITE_SIZE_32;
+  info->memoryMapped = 1;
+  info->pageSize = FLASH_PAGE_SIZE;
+  info->systemUnique = 0;
+  return SL_STATUS_OK;
+}
+
+static void host_hal_access(nvm3_HalNvmAccessCode_t access)
+{
+  (void)access;
+}
+
+static sl_status_t host_hal_page_erase(nvm3_HalPtr_t nvmAdr)
+{
+  memset(nvmAdr, 0xFF, FLASH_PAGE_SIZE);
+  return SL_STATUS_OK;
+}
+
+static sl_status_t host_hal_read_words(nvm3_HalPtr_t nvmAdr, void *dst, size_t wordCnt)
+{
+  memcpy(dst, nvmAdr, wordCnt * sizeof(uint32_t));
+  return SL_STATUS_OK;
+}
+
+static sl_status_t host_hal_write_words(nvm3_HalPtr_t nvmAdr, void const *src, size_t wordCnt)
+{
+  uint32_t *dst = nvmAdr;
+  uint32_t word;
+
+  for (size_t i = 0; i < wordCnt; i++) {
+    memcpy(&word, (const uint8_t *)src + (i * sizeof(uint32_t)), sizeof(word));
+    dst[i] &= word;
+  }
+  return SL_STATUS_OK;
+}
+
+static const nvm3_HalHandle_t host_hal = {
+  .open = host_hal_open,
+  .close = host_hal_close,
+  .getInfo = host_hal_get_info,
+  .access = host_hal_access,
+  .pageErase = host_hal_page_erase,
+  .readWords = host_hal_read_words,
+  .writeWords = host_hal_write_words,
+};
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+static uint32_t random_next(void)
+{
+  random_state = (random_state * 1103515245U) + 12345U;
+  return random_state >> 8;
+}
+
+static int parse_writes(const char *arg, unsigned long *writes)
+{
+  char *end;
+
+  *writes = strtoul(arg, &end, 10);
+  if ((end == arg) || (*end != '\0') || (*writes > 100000000UL)) {
+    fprintf(stderr, "bad write count: %s\n", arg);
+    return -1;
+  }
+  return 0;
+}
+
+// An image that cannot be read leaves the flash erased
+static int load_image(const char *path)
+{
+  FILE *file = fopen(path, "rb");
+  size_t read;
+
+  memset(flash, 0xFF, sizeof(flash));
+  if (file == NULL) {
+    if (errno == ENOENT) {
+      printf("%s: new erased image\n", path);
+      return 0;
+    }
+    perror(path);
+    return -1;
+  }
+  read = fread(flash, 1, sizeof(flash), file);
+  fclose(file);
+  if (read != sizeof(flash)) {
+    fprintf(stderr, "%s: %lu bytes, the instance has %lu\n", path,
+            (unsigned long)read, (unsigned long)sizeof(flash));
+    return -1;
+  }
+  return 0;
+}
+
+static int save_image(const char *path)
+{
+  FILE *file = fopen(path, "wb");
+
+  if ((file == NULL) || (fwrite(flash, 1, sizeof(flash), file) != sizeof(flash))) {
+    perror(path);
+    if (file != NULL) {
+      fclose(file);
+    }
+    return -1;
+  }
+  return (fclose(file) == 0) ? 0 : -1;
+}
+
+static void print_bar(const char *label, uint32_t value, uint32_t max, const char *unit)
+{
+  int width = (max == 0U) ? 0 : (int)(((uint64_t)value * HOST_BAR_WIDTH + max - 1U) / max);
+
+  printf("  %-10s %8lu %-7s |%.*s\n", label, (unsigned long)value, unit, width,
+         "########################################");
+}
+
+static sl_status_t replay(unsigned long writes)
+{
+  uint8_t data[NVM3_DEFAULT_MAX_OBJECT_SIZE];
+  sl_status_t sc;
+
+  memset(data, 0x5A, sizeof(data));
+  for (unsigned long i = 0; i < writes; i++) {
+    uint32_t pick = random_next() % 100U;
+    const host_range_t *range = &ranges[0];
+
+    for (size_t r = 0; r < NVM3_TELEMETRY_KEY_RANGE_COUNT; r++) {
+      range = &ranges[r];
+      if (pick < range->mix_percent) {
+        break;
+      }
+      pick -= range->mix_percent;
+    }
+    nvm3_ObjectKey_t key = range->key_min + (random_next() % range->mix_keys);
+    size_t len = range->mix_size_min
+                 + (random_next() % (range->mix_size_max - range->mix_size_min + 1U));
+
+    data[0] = (uint8_t)i;
+    sc = nvm3_writeData(&handle, key, data, len);
+    if (sc != SL_STATUS_OK) {
+      fprintf(stderr, "write %lu of key 0x%05lx: status 0x%lx\n", i,
+              (unsigned long)key, (unsigned long)sc);
+      return sc;
+    }
+    if (nvm3_repackNeeded(&handle)) {
+      sc = nvm3_repack(&handle);
+      if (sc != SL_STATUS_OK) {
+        fprintf(stderr, "repack: status 0x%lx\n", (unsigned long)sc);
+        return sc;
+      }
+    }
+  }
+  return SL_STATUS_OK;
+}
+
+static void report(void)
+{
+  nvm3_Telemetry_t t;
+  uint32_t erase_cnt[HOST_PAGES];
+  size_t page_cnt = HOST_PAGES;
+  uint32_t max = 0;
+  char label[32];
+
+  if (nvm3_getTelemetry(&handle, &t) == SL_STATUS_OK) {
+    printf("repacks: %lu user, %lu forced, %lu pages erased\n",
+           (unsigned long)t.userRepackCount, (unsigned long)t.forcedRepackCount,
+           (unsigned long)t.pageEraseCount);
+    printf("  copied %lu bytes, at most %lu in a step\n",
+           (unsigned long)t.repackBytesCopied, (unsigned long)t.repackMaxBytesCopied);
+    printf("writes per key range:\n");
+    for (size_t r = 0; r < NVM3_TELEMETRY_KEY_RANGE_COUNT; r++) {
+      max = (t.writeBytes[r] > max) ? t.writeBytes[r] : max;
+    }
+    for (size_t r = 0; r < NVM3_TELEMETRY_KEY_RANGE_COUNT; r++) {
+      printf("  %-10s %8lu writes\n", ranges[r].name, (unsigned long)t.writeCount[r]);
+      print_bar("", t.writeBytes[r], max, "bytes");
+    }
+  }
+
+  if (nvm3_getPageEraseCounts(&handle, erase_cnt, &page_cnt) == SL_STATUS_OK) {
+    printf("erase count per page:\n");
+    max = 0;
+    for (size_t i = 0; i < page_cnt; i++) {
+      max = (erase_cnt[i] > max) ? erase_cnt[i] : max;
+    }
+    for (size_t i = 0; i < page_cnt; i++) {
+      snprintf(label, sizeof(label), "page %lu", (unsigned long)i);
+      print_bar(label, erase_cnt[i], max, "erases");
+    }
+  }
+
+  printf("objects stored per key range:\n");
+  for (size_t r = 0; r < NVM3_TELEMETRY_KEY_RANGE_COUNT; r++) {
+    size_t count;
+    uint32_t bytes = 0;
+
+    if (r == NVM3_TELEMETRY_KEY_RANGE_OTHER) {
+      // Every key, less the ones of the other ranges
+      count = nvm3_enumObjects(&handle, keys, HOST_KEYS_MAX, NVM3_KEY_MIN, NVM3_KEY_MAX);
+    } else {
+      count = nvm3_enumObjects(&handle, keys, HOST_KEYS_MAX, ranges[r].key_min, ranges[r].key_max);
+    }
+    size_t stored = 0;
+    for (size_t k = 0; k < count; k++) {
+      uint32_t type;
+      size_t len;
+      bool other = true;
+
+      for (size_t o = 0; o < NVM3_TELEMETRY_KEY_RANGE_OTHER; o++) {
+        if ((keys[k] >= ranges[o].key_min) && (keys[k] <= ranges[o].key_max)) {
+          other = false;
+        }
+      }
+      if (((r == NVM3_TELEMETRY_KEY_RANGE_OTHER) && !other)
+          || (nvm3_getObjectInfo(&handle, keys[k], &type, &len) != SL_STATUS_OK)) {
+        continue;
+      }
+      stored++;
+      bytes += (uint32_t)len;
+    }
+    printf("  %-10s %8lu objects, %lu bytes\n", ranges[r].name,
+           (unsigned long)stored, (unsigned long)bytes);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  unsigned long writes = 0;
+  const char *path;
+  nvm3_Init_t init = {
+    .nvmAdr = flash,
+    .nvmSize = NVM3_DEFAULT_NVM_SIZE,
+    .cachePtr = cache,
+    .cacheEntryCount = NVM3_DEFAULT_CACHE_SIZE,
+    .maxObjectSize = NVM3_DEFAULT_MAX_OBJECT_SIZE,
+    .repackHeadroom = NVM3_DEFAULT_REPACK_HEADROOM,
+    .halHandle = &host_hal,
+  };
+  sl_status_t sc;
+
+  if ((argc == 4) && (strcmp(argv[1], "-w") == 0)) {
+    if (parse_writes(argv[2], &writes) != 0) {
+      return 2;
+    }
+    path = argv[3];
+  } else if (argc == 2) {
+    path = argv[1];
+  } else {
+    fprintf(stderr, "usage: %s [-w <writes>] <image>\n", argv[0]);
+    return 2;
+  }
+
+  if (load_image(path) != 0) {
+    return 1;
+  }
+  sc = nvm3_open(&handle, &init);
+  if (sc != SL_STATUS_OK) {
+    fprintf(stderr, "%s: open status 0x%lx\n", path, (unsigned long)sc);
+    return 1;
+  }
+  printf("%s: %u pages of %u bytes, %lu writes\n", path, (unsigned int)HOST_PAGES,
+         (unsigned int)FLASH_PAGE_SIZE, writes);
+  sc = replay(writes);
+  report();
+  nvm3_close(&handle);
+  if (save_image(path) != 0) {
+    return 1;
+  }
+  return (sc == SL_STATUS_OK) ? 0 : 1;
+}
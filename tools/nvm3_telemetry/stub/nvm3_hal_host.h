@@ -0,0 +1,13 @@
+// Host stand-in, the EFR32BG22 flash page and the compiler helpers of the
+// device build
+#ifndef NVM3_HAL_HOST_H
+#define NVM3_HAL_HOST_H
+
+#include <assert.h>
+
+#define FLASH_PAGE_SIZE                     8192U
+
+#define __STATIC_INLINE                     static inline
+#define SL_MIN(a, b)                        ((a) < (b) ? (a) : (b))
+
+#endif // NVM3_HAL_HOST_H
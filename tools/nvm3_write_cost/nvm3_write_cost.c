@@ -0,0 +1,160 @@
+/***************************************************************************//**
+ * @file
+ * @brief Model the time of NVM3 flash writes with and without the LDMA
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Usage: nvm3_write_cost [-p <us>] <Hz>...
+//
+// Estimates how long the NVM3 flash HAL holds the CPU for writes of a range
+// of sizes, programmed word by word by MSC_WriteWord() or through the LDMA by
+// MSC_WriteWordDma(), at each core clock on the command line.
+//
+// Both paths keep the CPU busy until the write ends: MSC_WriteWord() polls
+// WDATAREADY before every word, MSC_WriteWordDma() spins on LDMA CHDONE. The
+// MSC takes the next word while it programs the current one, so a path costs
+// one word programming time (-p, 11 us by default) per word unless feeding a
+// word takes longer, plus its fixed setup. The cycle counts below are read
+// from the two emlib functions, counting peripheral accesses and calls, and
+// are estimates: measure on the board before relying on small differences.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// -----------------------------------------------------------------------------
+// Private macros
+
+#define NWC_PROGRAM_US_DEFAULT      11.0
+// Flash page size of the EFR32BG22, a burst ends at a page boundary
+#define NWC_PAGE_WORDS              (8192 / 4)
+
+// MSC_WriteWord(): unlock and WREN, then per burst writeBurst() loading
+// ADDRB and the first word, and WRITEEND with the two BUSY waits
+#define NWC_CPU_SETUP_CYCLES        30
+#define NWC_CPU_BURST_CYCLES        60
+// mscStatusWait() call and a WDATAREADY poll, then the WDATA store
+#define NWC_CPU_WORD_CYCLES         35
+
+// MSC_WriteWordDma(): LDMA, LDMAXBAR and channel setup, unlock and WREN,
+// then per burst the descriptor, CHEN, CHDONE clear, WRITEEND and BUSY wait
+#define NWC_DMA_SETUP_CYCLES        50
+#define NWC_DMA_BURST_CYCLES        70
+// LDMA arbitration and the word transfer on a WDATA request
+#define NWC_DMA_WORD_CYCLES         6
+
+// -----------------------------------------------------------------------------
+// Private variables
+
+// Write sizes in words: a page state word, object headers, small objects,
+// the largest object of the default instance and a large raw write
+static const unsigned int sizes[] = { 1, 4, 16, 64, 256, 2048 };
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+static int parse_program_us(const char *arg, double *program_us)
+{
+  char *end;
+
+  *program_us = strtod(arg, &end);
+  if ((end == arg) || (*end != '\0') || !(*program_us > 0.0) || (*program_us > 1000.0)) {
+    fprintf(stderr, "bad programming time: %s\n", arg);
+    return -1;
+  }
+  return 0;
+}
+
+static int parse_clock(const char *arg, double *mhz)
+{
+  char *end;
+  unsigned long hz = strtoul(arg, &end, 10);
+
+  if ((end == arg) || (*end != '\0') || (hz == 0) || (hz > 1000000000UL)) {
+    fprintf(stderr, "bad clock: %s\n", arg);
+    return -1;
+  }
+  *mhz = hz / 1000000.0;
+  return 0;
+}
+
+// Time of a write in us: the fixed cycles, plus per word the longer of the
+// programming time and the time to feed the word
+static double write_us(unsigned int words,
+                       double mhz,
+                       double program_us,
+                       unsigned int setup_cycles,
+                       unsigned int burst_cycles,
+                       unsigned int word_cycles)
+{
+  unsigned int bursts = (words + NWC_PAGE_WORDS - 1) / NWC_PAGE_WORDS;
+  double feed_us = word_cycles / mhz;
+  double word_us = (feed_us > program_us) ? feed_us : program_us;
+
+  return (setup_cycles + bursts * burst_cycles) / mhz + words * word_us;
+}
+
+static void report(double mhz, double program_us)
+{
+  printf("core %.1f MHz, word programming %.1f us\n", mhz, program_us);
+  printf("   words     cpu us     dma us  dma saves us\n");
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+    double cpu_us = write_us(sizes[i], mhz, program_us, NWC_CPU_SETUP_CYCLES,
+                             NWC_CPU_BURST_CYCLES, NWC_CPU_WORD_CYCLES);
+    double dma_us = write_us(sizes[i], mhz, program_us, NWC_DMA_SETUP_CYCLES,
+                             NWC_DMA_BURST_CYCLES, NWC_DMA_WORD_CYCLES);
+
+    printf("  %6u  %9.1f  %9.1f  %12.1f\n",
+           sizes[i], cpu_us, dma_us, cpu_us - dma_us);
+  }
+  printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+  double program_us = NWC_PROGRAM_US_DEFAULT;
+  double mhz;
+  int first = 1;
+
+  if ((argc > 2) && (strcmp(argv[1], "-p") == 0)) {
+    if (parse_program_us(argv[2], &program_us) != 0) {
+      return 2;
+    }
+    first = 3;
+  }
+  if (first >= argc) {
+    fprintf(stderr, "usage: %s [-p <us>] <Hz>...\n", argv[0]);
+    return 2;
+  }
+  for (int i = first; i < argc; i++) {
+    if (parse_clock(argv[i], &mhz) != 0) {
+      return 2;
+    }
+    report(mhz, program_us);
+  }
+  return 0;
+}
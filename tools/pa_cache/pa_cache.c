@@ -0,0 +1,238 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of the PA power conversion cache
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Usage: pa_cache
+//        pa_cache_small
+//
+// Builds the SDK pa_conversions_efr32.c with the EFR32BG22 PA curves and the
+// project configuration, pa_cache_small with a conversion cache too small
+// for every PA. For both curve sets it fills the cache, converts every
+// deci-dBm value from -3276.8 to 3276.7 dBm and every raw level of every
+// power mode, then installs the curves again, which drops the cache, and
+// compares each result with the curve walk.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// The SDK module under test, built with the stub headers
+#include "../../base/simplicity_sdk_2025.6.0/platform/radio/rail_lib/plugin/pa-conversions/pa_conversions_efr32.c"
+
+// -----------------------------------------------------------------------------
+// Private macros
+
+#define HOST_MODES              RAIL_TX_POWER_MODE_NONE
+#define HOST_POWERS             (INT16_MAX - INT16_MIN + 1)
+#define HOST_LEVELS             (UINT8_MAX + 1)
+#define HOST_MISMATCHES_SHOWN   4
+
+// -----------------------------------------------------------------------------
+// Private variables
+
+static RAIL_TxPowerLevel_t cached_raw[HOST_MODES][HOST_POWERS];
+static RAIL_TxPower_t cached_dbm[HOST_MODES][HOST_LEVELS];
+static uint32_t failures;
+
+// -----------------------------------------------------------------------------
+// Host stand-ins, RAIL library functions the conversions do not call
+
+RAIL_Status_t RAIL_VerifyTxPowerCurves(const struct RAIL_TxPowerCurvesConfigAlt *config)
+{
+  (void)config;
+  return RAIL_STATUS_NO_ERROR;
+}
+
+bool RAIL_SupportsTxPowerModeAlt(RAIL_Handle_t railHandle,
+                                 RAIL_TxPowerMode_t *powerMode,
+                                 RAIL_TxPowerLevel_t *maxPowerLevel,
+                                 RAIL_TxPowerLevel_t *minPowerLevel)
+{
+  (void)railHandle;
+  (void)powerMode;
+  (void)maxPowerLevel;
+  (void)minPowerLevel;
+  return false;
+}
+
+RAIL_Status_t RAIL_ConfigTxPower(RAIL_Handle_t railHandle,
+                                 const RAIL_TxPowerConfig_t *config)
+{
+  (void)railHandle;
+  (void)config;
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t RAIL_GetTxPowerConfig(RAIL_Handle_t railHandle,
+                                    RAIL_TxPowerConfig_t *config)
+{
+  (void)railHandle;
+  (void)config;
+  return RAIL_STATUS_INVALID_CALL;
+}
+
+RAIL_Status_t RAIL_SetTxPowerDbm(RAIL_Handle_t railHandle,
+                                 RAIL_TxPower_t power)
+{
+  (void)railHandle;
+  (void)power;
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_TxPower_t RAIL_GetTxPowerDbm(RAIL_Handle_t railHandle)
+{
+  (void)railHandle;
+  return RAIL_TX_POWER_MIN;
+}
+
+void RAIL_EnablePaCal(bool enable)
+{
+  (void)enable;
+}
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+static void check(const char *name, bool ok)
+{
+  printf("check %-40s %s\n", name, ok ? "ok" : "FAILED");
+  if (!ok) {
+    failures++;
+  }
+}
+
+static bool cache_is_empty(void)
+{
+  for (uint32_t pa = 0; pa < RAIL_NUM_PA; pa++) {
+    if ((paConversionCache[pa].powerCount != 0U) || (paConversionCache[pa].levelCount != 0U)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static uint32_t cached_pa_count(void)
+{
+  uint32_t count = 0;
+  for (uint32_t pa = 0; pa < RAIL_NUM_PA; pa++) {
+    count += (paConversionCache[pa].levelCount != 0U) ? 1U : 0U;
+  }
+  return count;
+}
+
+// Pool bytes and tables of each PA
+static void print_cache(void)
+{
+  uint32_t used = 0;
+
+  for (uint32_t pa = 0; pa < RAIL_NUM_PA; pa++) {
+    PaConversionCache_t const *cache = &paConversionCache[pa];
+    if (cache->levelCount == 0U) {
+      printf("  PA %u: curve walk\n", (unsigned int)pa);
+      continue;
+    }
+    printf("  PA %u: levels 0..%u, %d..%d deci-dBm, %u bytes\n",
+           (unsigned int)pa, (unsigned int)(cache->levelCount - 1U),
+           (int)cache->minPower, (int)(cache->minPower + cache->powerCount - 1),
+           (unsigned int)(cache->levelCount * sizeof(int16_t) + cache->powerCount));
+    if (cache->powerOffset + cache->powerCount > used) {
+      used = cache->powerOffset + cache->powerCount;
+    }
+  }
+  printf("  pool: %u of %u bytes\n", (unsigned int)used,
+         (unsigned int)SL_RAIL_UTIL_PA_CONVERSION_CACHE_SIZE);
+}
+
+static void convert_all(bool store, uint32_t *mismatches)
+{
+  for (uint32_t mode = 0; mode < HOST_MODES; mode++) {
+    for (int32_t power = INT16_MIN; power <= INT16_MAX; power++) {
+      RAIL_TxPowerLevel_t raw = RAIL_ConvertDbmToRaw(RAIL_EFR32_HANDLE, (RAIL_TxPowerMode_t)mode,
+                                                     (RAIL_TxPower_t)power);
+      RAIL_TxPowerLevel_t *cached = &cached_raw[mode][power - INT16_MIN];
+      if (store) {
+        *cached = raw;
+      } else if (*cached != raw) {
+        if (*mismatches < HOST_MISMATCHES_SHOWN) {
+          printf("  mode %u, %d deci-dBm: raw %u cached, %u from the curve\n",
+                 (unsigned int)mode, (int)power, (unsigned int)*cached, (unsigned int)raw);
+        }
+        (*mismatches)++;
+      }
+    }
+    for (uint32_t level = 0; level < HOST_LEVELS; level++) {
+      RAIL_TxPower_t dbm = RAIL_ConvertRawToDbm(RAIL_EFR32_HANDLE, (RAIL_TxPowerMode_t)mode,
+                                                (RAIL_TxPowerLevel_t)level);
+      RAIL_TxPower_t *cached = &cached_dbm[mode][level];
+      if (store) {
+        *cached = dbm;
+      } else if (*cached != dbm) {
+        if (*mismatches < HOST_MISMATCHES_SHOWN) {
+          printf("  mode %u, raw %u: %d deci-dBm cached, %d from the curve\n",
+                 (unsigned int)mode, (unsigned int)level, (int)*cached, (int)dbm);
+        }
+        (*mismatches)++;
+      }
+    }
+  }
+}
+
+static void run_curves(const char *name, const RAIL_TxPowerCurvesConfigAlt_t *curves)
+{
+  uint32_t mismatches = 0;
+
+  printf("\n%s curves\n", name);
+  check("curves installed", RAIL_InitTxPowerCurvesAlt(curves) == RAIL_STATUS_NO_ERROR);
+  paConversionCacheBuild();
+  print_cache();
+  check("cache filled", cached_pa_count() > 0U);
+  convert_all(true, NULL);
+
+  check("installing curves drops the cache",
+        (RAIL_InitTxPowerCurvesAlt(curves) == RAIL_STATUS_NO_ERROR) && cache_is_empty());
+  convert_all(false, &mismatches);
+  printf("  %u conversions compared\n",
+         (unsigned int)(HOST_MODES * (HOST_POWERS + HOST_LEVELS)));
+  check("cached conversions match the curves", mismatches == 0U);
+}
+
+int main(void)
+{
+  printf("conversion cache of %u bytes, %u PAs\n",
+         (unsigned int)SL_RAIL_UTIL_PA_CONVERSION_CACHE_SIZE, (unsigned int)RAIL_NUM_PA);
+
+  // The curves of the project configuration, through the init of the
+  // firmware
+  sl_rail_util_pa_init();
+  check("init fills the cache", cached_pa_count() > 0U);
+
+  run_curves("VBAT", &RAIL_TxPowerCurvesVbat);
+  run_curves("DCDC", &RAIL_TxPowerCurvesDcdc);
+  return (failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,5 @@
+// Host stand-in, the PA conversions use no clock
+#ifndef EM_CMU_H
+#define EM_CMU_H
+
+#endif // EM_CMU_H
@@ -0,0 +1,12 @@
+// Host stand-in, the project configuration with the cache size of the build
+#ifndef HOST_RAIL_UTIL_PA_CONFIG_H
+#define HOST_RAIL_UTIL_PA_CONFIG_H
+
+#include "../../../base/config/sl_rail_util_pa_config.h"
+
+#ifdef HOST_PA_CONVERSION_CACHE_SIZE
+#undef SL_RAIL_UTIL_PA_CONVERSION_CACHE_SIZE
+#define SL_RAIL_UTIL_PA_CONVERSION_CACHE_SIZE  HOST_PA_CONVERSION_CACHE_SIZE
+#endif
+
+#endif // HOST_RAIL_UTIL_PA_CONFIG_H
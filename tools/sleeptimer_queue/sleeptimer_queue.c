@@ -0,0 +1,557 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of the sleeptimer timer queues
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Usage: sleeptimer_queue_heap
+//        sleeptimer_queue_list
+//
+// Runs the SDK sl_sleeptimer.c against a simulated 32768 Hz 32 bit counter,
+// built once with the binary min-heap timer queue and once with the delta
+// list. Time advances to the next compare match or counter overflow and runs
+// the timer interrupt there, so a callback runs on the tick its timer
+// expires unless an earlier callback kept the interrupt busy. Both builds run
+// the same checks, then a random sequence of timer starts, stops and time
+// steps compared with a reference model. The counter starts just before its
+// first overflow.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "sl_sleeptimer.h"
+#include "sli_sleeptimer_hal.h"
+
+// -----------------------------------------------------------------------------
+// Private macros
+
+#define HOST_TIMER_HZ           32768u
+#define HOST_COUNTER_START      0xFFFF0000u
+// Every timer the heap holds, and one more
+#define HOST_TIMERS             (SL_SLEEPTIMER_TIMER_QUEUE_HEAP_SIZE + 1)
+#define HOST_LOG_SIZE           64
+#define HOST_RANDOM_STEPS       20000
+#define HOST_COUNTER_WRAP       ((uint64_t)UINT32_MAX + 1u)
+
+// -----------------------------------------------------------------------------
+// Private types
+
+// Reference model of a timer
+typedef struct {
+  sl_sleeptimer_timer_handle_t handle;
+  bool running;
+  uint64_t deadline;        // absolute 64 bits tick
+  uint32_t period;          // 0 for a one-shot timer
+  uint32_t sequence;        // start order, ties expire first in first out
+  uint8_t priority;
+} host_timer_t;
+
+// -----------------------------------------------------------------------------
+// Private variables
+
+static uint32_t counter = HOST_COUNTER_START;
+static uint64_t now = HOST_COUNTER_START;
+static uint32_t compare;
+static uint8_t int_enabled;
+static uint8_t int_pending;
+static bool in_irq;
+static uint32_t overflows;
+
+static host_timer_t timers[HOST_TIMERS];
+static uint32_t sequence;
+static uint32_t random_state = 1u;
+
+// Callbacks of the fixed checks, in order
+static uint32_t log_count;
+static uint32_t log_timer[HOST_LOG_SIZE];
+static uint64_t log_tick[HOST_LOG_SIZE];
+// Ticks a callback keeps the interrupt busy
+static uint32_t busy_ticks;
+
+// Model mismatches of the random sequence
+static uint32_t fired;
+static uint32_t shared;
+static uint32_t late;
+static uint32_t misordered;
+static uint32_t missed;
+static uint32_t bad_status;
+static uint32_t bad_remaining;
+static bool last_fired;
+static uint64_t last_tick;
+static uint8_t last_priority;
+static uint32_t last_sequence;
+
+static uint32_t asserts;
+static uint32_t failures;
+
+// -----------------------------------------------------------------------------
+// Host stand-ins
+
+void sleeptimer_host_assert(bool ok)
+{
+  if (!ok) {
+    asserts++;
+  }
+}
+
+void sleeptimer_hal_init_timer(void)
+{
+}
+
+uint32_t sleeptimer_hal_get_counter(void)
+{
+  return counter;
+}
+
+uint32_t sleeptimer_hal_get_compare(void)
+{
+  return compare;
+}
+
+void sleeptimer_hal_set_compare(uint32_t value)
+{
+  compare = value;
+}
+
+uint32_t sleeptimer_hal_get_timer_frequency(void)
+{
+  return HOST_TIMER_HZ;
+}
+
+void sleeptimer_hal_enable_int(uint8_t local_flag)
+{
+  int_enabled |= local_flag;
+}
+
+void sleeptimer_hal_disable_int(uint8_t local_flag)
+{
+  int_enabled &= (uint8_t)~local_flag;
+}
+
+void sleeptimer_hal_set_int(uint8_t local_flag)
+{
+  int_pending |= local_flag;
+}
+
+bool sli_sleeptimer_hal_is_int_status_set(uint8_t local_flag)
+{
+  return (int_pending & local_flag) != 0u;
+}
+
+uint16_t sleeptimer_hal_get_clock_accuracy(void)
+{
+  return 0u;
+}
+
+uint32_t sleeptimer_hal_get_capture(void)
+{
+  return counter;
+}
+
+void sleeptimer_hal_reset_prs_signal(void)
+{
+}
+
+void sleeptimer_hal_disable_prs_compare_and_capture_channel(void)
+{
+}
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+static void check(const char *name, bool ok)
+{
+  printf("check %-40s %s\n", name, ok ? "ok" : "FAILED");
+  if (!ok) {
+    failures++;
+  }
+}
+
+// Runs the timer interrupt while it is pending, clearing the flags first like
+// the HAL interrupt handlers
+static void run_irq(void)
+{
+  uint8_t flags;
+
+  if (in_irq) {
+    return;
+  }
+  in_irq = true;
+  while ((flags = int_pending & int_enabled) != 0u) {
+    int_pending &= (uint8_t)~flags;
+    process_timer_irq(flags);
+  }
+  in_irq = false;
+}
+
+// Moves time forward, stopping on each compare match and overflow to run the
+// interrupt. From a callback it only sets the flags, the interrupt runs again
+// when the callback returns.
+static void advance(uint64_t ticks)
+{
+  run_irq();
+  while (ticks > 0u) {
+    uint64_t step = HOST_COUNTER_WRAP - counter;
+    uint64_t to_compare = (uint32_t)(compare - counter);
+
+    if (((int_enabled & SLEEPTIMER_EVENT_COMP) != 0u)
+        && (to_compare != 0u) && (to_compare < step)) {
+      step = to_compare;
+    }
+    if (step > ticks) {
+      step = ticks;
+    }
+    counter += (uint32_t)step;
+    now += step;
+    ticks -= step;
+    if (counter == 0u) {
+      int_pending |= SLEEPTIMER_EVENT_OF;
+      overflows++;
+    }
+    if (((int_enabled & SLEEPTIMER_EVENT_COMP) != 0u) && (counter == compare)) {
+      int_pending |= SLEEPTIMER_EVENT_COMP;
+    }
+    run_irq();
+  }
+}
+
+static uint32_t host_random(void)
+{
+  random_state = random_state * 1664525u + 1013904223u;
+  return random_state >> 8;
+}
+
+static uint32_t timer_index(const host_timer_t *timer)
+{
+  return (uint32_t)(timer - timers);
+}
+
+// Callback of the fixed checks, logs the timer and the tick
+static void timer_logged(sl_sleeptimer_timer_handle_t *handle, void *data)
+{
+  (void)handle;
+  if (log_count < HOST_LOG_SIZE) {
+    log_timer[log_count] = timer_index(data);
+    log_tick[log_count] = sl_sleeptimer_get_tick_count64();
+  }
+  log_count++;
+  if (busy_ticks != 0u) {
+    advance(busy_ticks);
+    busy_ticks = 0u;
+  }
+}
+
+// Callback of the random sequence, compares the expiry with the model
+static void timer_modelled(sl_sleeptimer_timer_handle_t *handle, void *data)
+{
+  host_timer_t *timer = data;
+  uint64_t tick = sl_sleeptimer_get_tick_count64();
+
+  (void)handle;
+  fired++;
+  if (!timer->running || (tick != timer->deadline) || (tick != now)) {
+    late++;
+  }
+  // Timers expiring on the same tick run by priority, then in start order
+  if (last_fired && (tick == last_tick)) {
+    shared++;
+  }
+  if (last_fired && (tick == last_tick)
+      && ((timer->priority < last_priority)
+          || ((timer->priority == last_priority)
+              && ((int32_t)(timer->sequence - last_sequence) < 0)))) {
+    misordered++;
+  }
+  last_fired = true;
+  last_tick = tick;
+  last_priority = timer->priority;
+  last_sequence = timer->sequence;
+
+  if (timer->period != 0u) {
+    timer->deadline += timer->period;
+    timer->sequence = sequence++;
+  } else {
+    timer->running = false;
+  }
+}
+
+static void reset_log(void)
+{
+  log_count = 0u;
+}
+
+static sl_status_t start_logged(uint32_t i, uint32_t timeout, uint8_t priority)
+{
+  return sl_sleeptimer_start_timer(&timers[i].handle, timeout, timer_logged,
+                                   &timers[i], priority, 0u);
+}
+
+static bool log_is(const uint32_t *expected, const uint64_t *ticks, uint32_t count)
+{
+  if (log_count != count) {
+    return false;
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    if ((log_timer[i] != expected[i]) || ((ticks != NULL) && (log_tick[i] != ticks[i]))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void run_wrap_checks(void)
+{
+  uint64_t start = now;
+  bool ok = true;
+
+  // The 64 bits deadline of the heap and the 32 bits deltas of the list
+  // both cross the counter overflow
+  reset_log();
+  check("timer across the counter overflow",
+        (start_logged(0u, 0x20000u, 0u) == SL_STATUS_OK)
+        && (start_logged(1u, UINT32_MAX, 0u) == SL_STATUS_OK));
+  advance(0x20000u);
+  check("expires after the overflow",
+        log_is((const uint32_t[]){ 0u }, (const uint64_t[]){ start + 0x20000u }, 1u)
+        && (overflows == 1u));
+  advance(UINT32_MAX - 0x20000u);
+  check("longest timer, one tick short of a wrap",
+        log_is((const uint32_t[]){ 0u, 1u },
+               (const uint64_t[]){ start + 0x20000u, start + UINT32_MAX }, 2u));
+
+  // A periodic timer of half the counter range, on every overflow and in
+  // between
+  reset_log();
+  start = now;
+  check("periodic timer of half the counter",
+        sl_sleeptimer_start_periodic_timer(&timers[2].handle, 0x80000000u, timer_logged,
+                                           &timers[2], 0u, 0u) == SL_STATUS_OK);
+  advance(3u * HOST_COUNTER_WRAP);
+  for (uint32_t i = 0; i < 6u; i++) {
+    ok &= (log_timer[i] == 2u) && (log_tick[i] == start + (i + 1u) * 0x80000000ull);
+  }
+  check("expires on time over three overflows", ok && (log_count == 6u));
+  check("stopped periodic timer", sl_sleeptimer_stop_timer(&timers[2].handle) == SL_STATUS_OK);
+}
+
+static void run_order_checks(void)
+{
+  static const uint32_t timeouts[] = { 700, 300, 500, 300, 100, 700, 300, 200 };
+  static const uint32_t by_deadline[] = { 4, 7, 1, 3, 6, 2, 0, 5 };
+  uint32_t count = sizeof(timeouts) / sizeof(timeouts[0]);
+  uint64_t ticks[sizeof(timeouts) / sizeof(timeouts[0])];
+  uint64_t start = now;
+  bool ok = true;
+
+  reset_log();
+  for (uint32_t i = 0; i < count; i++) {
+    ok &= start_logged(i, timeouts[i], 0u) == SL_STATUS_OK;
+    ticks[i] = start + timeouts[by_deadline[i]];
+  }
+  advance(1000u);
+  check("expire by deadline, ties in start order", ok && log_is(by_deadline, ticks, count));
+
+  // Same deadline, the highest priority (lowest value) first
+  reset_log();
+  ok = (start_logged(0u, 100u, 3u) == SL_STATUS_OK)
+       && (start_logged(1u, 100u, 0u) == SL_STATUS_OK)
+       && (start_logged(2u, 100u, 2u) == SL_STATUS_OK)
+       && (start_logged(3u, 100u, 1u) == SL_STATUS_OK);
+  advance(100u);
+  check("same deadline by priority", ok && log_is((const uint32_t[]){ 1u, 3u, 2u, 0u }, NULL, 4u));
+
+  // The first callback keeps the interrupt busy until the others expired,
+  // they then run by priority whatever their deadline
+  reset_log();
+  ok = (start_logged(0u, 100u, 2u) == SL_STATUS_OK)
+       && (start_logged(1u, 150u, 1u) == SL_STATUS_OK)
+       && (start_logged(2u, 200u, 0u) == SL_STATUS_OK)
+       && (start_logged(3u, 120u, 3u) == SL_STATUS_OK);
+  advance(99u);
+  busy_ticks = 200u;
+  advance(1u);
+  check("expired timers by priority", ok && log_is((const uint32_t[]){ 0u, 2u, 1u, 3u }, NULL, 4u));
+
+  // Stopped timers, the first one included, never expire
+  reset_log();
+  start = now;
+  ok = true;
+  for (uint32_t i = 0; i < count; i++) {
+    ok &= start_logged(i, timeouts[i], 0u) == SL_STATUS_OK;
+  }
+  ok &= (sl_sleeptimer_stop_timer(&timers[4].handle) == SL_STATUS_OK)
+        && (sl_sleeptimer_stop_timer(&timers[3].handle) == SL_STATUS_OK)
+        && (sl_sleeptimer_stop_timer(&timers[5].handle) == SL_STATUS_OK)
+        && (sl_sleeptimer_stop_timer(&timers[5].handle) == SL_STATUS_INVALID_STATE);
+  advance(1000u);
+  check("stopped timers never expire",
+        ok && log_is((const uint32_t[]){ 7u, 1u, 6u, 2u, 0u },
+                     (const uint64_t[]){ start + 200u, start + 300u, start + 300u,
+                                         start + 500u, start + 700u }, 5u));
+}
+
+static void run_capacity_checks(void)
+{
+  bool ok = true;
+  sl_status_t status;
+
+  reset_log();
+  for (uint32_t i = 0; i + 1u < HOST_TIMERS; i++) {
+    ok &= start_logged(i, 1000u + i, 0u) == SL_STATUS_OK;
+  }
+  status = start_logged(HOST_TIMERS - 1u, 500u, 0u);
+#if SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_HEAP
+  check("full heap refuses a timer", ok && (status == SL_STATUS_NO_MORE_RESOURCE));
+  advance(2000u);
+  check("full heap timers all expire", log_count == HOST_TIMERS - 1u);
+#else
+  check("list takes a timer past the heap size", ok && (status == SL_STATUS_OK));
+  advance(2000u);
+  check("list timers all expire", log_count == HOST_TIMERS);
+#endif
+}
+
+static uint32_t random_timeout(bool periodic)
+{
+  if (periodic) {
+    // Long enough to keep the callbacks of the long steps few
+    return ((host_random() % 64u) + 1u) << 20;
+  }
+  if ((host_random() % 16u) == 0u) {
+    return 0x80000000u + (host_random() << 7);
+  }
+  // Few distinct values, so that deadlines often tie
+  return ((host_random() % 64u) + 1u) * 16u;
+}
+
+static void random_start(host_timer_t *timer, bool restart)
+{
+  bool periodic = (host_random() % 4u) == 0u;
+  uint32_t timeout = random_timeout(periodic);
+  uint8_t priority = (uint8_t)(host_random() % 4u);
+  sl_status_t expected = SL_STATUS_OK;
+  sl_status_t status;
+
+  if (restart) {
+    status = periodic
+             ? sl_sleeptimer_restart_periodic_timer(&timer->handle, timeout, timer_modelled,
+                                                    timer, priority, 0u)
+             : sl_sleeptimer_restart_timer(&timer->handle, timeout, timer_modelled,
+                                           timer, priority, 0u);
+  } else {
+    if (timer->running) {
+      expected = periodic ? SL_STATUS_INVALID_STATE : SL_STATUS_NOT_READY;
+    }
+    status = periodic
+             ? sl_sleeptimer_start_periodic_timer(&timer->handle, timeout, timer_modelled,
+                                                  timer, priority, 0u)
+             : sl_sleeptimer_start_timer(&timer->handle, timeout, timer_modelled,
+                                         timer, priority, 0u);
+  }
+  if (status != expected) {
+    bad_status++;
+  }
+  if (expected == SL_STATUS_OK) {
+    timer->running = true;
+    timer->deadline = now + timeout;
+    timer->period = periodic ? timeout : 0u;
+    timer->sequence = sequence++;
+    timer->priority = priority;
+  }
+}
+
+static void run_random(void)
+{
+  uint32_t start_fired;
+
+  // Every timer the heap holds, none left from the fixed checks
+  for (uint32_t i = 0; i < HOST_TIMERS; i++) {
+    (void)sl_sleeptimer_stop_timer(&timers[i].handle);
+  }
+  start_fired = fired;
+  overflows = 0u;
+  for (uint32_t step = 0; step < HOST_RANDOM_STEPS; step++) {
+    host_timer_t *timer = &timers[host_random() % (HOST_TIMERS - 1u)];
+    uint32_t op = host_random() % 10u;
+    bool running = false;
+    uint32_t remaining = 0u;
+
+    if (op < 3u) {
+      random_start(timer, false);
+    } else if (op == 3u) {
+      random_start(timer, true);
+    } else if (op == 4u) {
+      if (sl_sleeptimer_stop_timer(&timer->handle)
+          != (timer->running ? SL_STATUS_OK : SL_STATUS_INVALID_STATE)) {
+        bad_status++;
+      }
+      timer->running = false;
+    } else if (op == 5u) {
+      sl_status_t status = sl_sleeptimer_get_timer_time_remaining(&timer->handle, &remaining);
+      (void)sl_sleeptimer_is_timer_running(&timer->handle, &running);
+      if ((running != timer->running)
+          || (status != (timer->running ? SL_STATUS_OK : SL_STATUS_NOT_READY))
+          || (timer->running && (remaining != timer->deadline - now))) {
+        bad_remaining++;
+      }
+    } else if ((host_random() % 32u) == 0u) {
+      advance(HOST_COUNTER_WRAP / 2u + host_random());
+    } else {
+      advance(host_random() % 2048u);
+    }
+    for (uint32_t i = 0; i + 1u < HOST_TIMERS; i++) {
+      if (timers[i].running && (timers[i].deadline <= now)) {
+        missed++;
+      }
+    }
+  }
+  printf("\n%u random steps: %u callbacks, %u on the tick of the previous one, "
+         "%u counter overflows\n\n",
+         (unsigned int)HOST_RANDOM_STEPS, (unsigned int)(fired - start_fired),
+         (unsigned int)shared, (unsigned int)overflows);
+  check("callbacks on the expiry tick", late == 0u);
+  check("same tick by priority, then start order", misordered == 0u);
+  check("no timer missed", missed == 0u);
+  check("start and stop status", bad_status == 0u);
+  check("running and remaining time", bad_remaining == 0u);
+}
+
+int main(void)
+{
+#if SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_HEAP
+  printf("timer queue: heap of %u timers\n\n", (unsigned int)SL_SLEEPTIMER_TIMER_QUEUE_HEAP_SIZE);
+#else
+  printf("timer queue: delta list\n\n");
+#endif
+  check("init", sl_sleeptimer_init() == SL_STATUS_OK);
+  run_wrap_checks();
+  run_order_checks();
+  run_capacity_checks();
+  run_random();
+  check("no assertion", asserts == 0u);
+  return (failures == 0u) ? 0 : 1;
+}
@@ -0,0 +1,10 @@
+// Host stand-in, the sleeptimer peripheral is simulated by the test
+#ifndef EM_DEVICE_H
+#define EM_DEVICE_H
+
+#include <stdint.h>
+
+#define __WEAK                              __attribute__((weak))
+#define __CLZ(value)                        ((uint8_t)__builtin_clz(value))
+
+#endif // EM_DEVICE_H
@@ -0,0 +1,11 @@
+// Host stand-in, assertions are counted by the test
+#ifndef SL_ASSERT_H
+#define SL_ASSERT_H
+
+#include <stdbool.h>
+
+void sleeptimer_host_assert(bool ok);
+
+#define EFM_ASSERT(expr)                    sleeptimer_host_assert(expr)
+
+#endif // SL_ASSERT_H
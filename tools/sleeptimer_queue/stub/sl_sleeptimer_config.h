@@ -0,0 +1,10 @@
+// Host stand-in, the project configuration with the timer queue of the build
+#ifndef HOST_SLEEPTIMER_CONFIG_H
+#define HOST_SLEEPTIMER_CONFIG_H
+
+#include "../../../base/config/sl_sleeptimer_config.h"
+
+#undef SL_SLEEPTIMER_TIMER_QUEUE
+#define SL_SLEEPTIMER_TIMER_QUEUE           HOST_TIMER_QUEUE
+
+#endif // HOST_SLEEPTIMER_CONFIG_H
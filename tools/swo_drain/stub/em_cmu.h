@@ -0,0 +1,4 @@
+// Host stand-in, the clock manager is present so nothing is used
+#ifndef EM_CMU_H
+#define EM_CMU_H
+#endif // EM_CMU_H
@@ -0,0 +1,64 @@
+// Host stand-in for the Cortex-M33 debug registers used by sl_debug_swo.c.
+// Every ITM access goes through swo_host_itm(), which lets the test see each
+// stimulus port write and model the port as busy while the SWO line sends.
+#ifndef EM_DEVICE_H
+#define EM_DEVICE_H
+
+#include <stdint.h>
+
+#define __CORTEX_M                          33
+#define _SILICON_LABS_32B_SERIES            2
+
+typedef union {
+  volatile uint8_t u8;
+  volatile uint16_t u16;
+  volatile uint32_t u32;
+} ITM_PORT_Type;
+
+typedef struct {
+  ITM_PORT_Type PORT[32];
+  volatile uint32_t TER;
+  volatile uint32_t TCR;
+  volatile uint32_t LAR;
+} ITM_Type;
+
+typedef struct {
+  volatile uint32_t DHCSR;
+  volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct {
+  volatile uint32_t CTRL;
+} DWT_Type;
+
+typedef struct {
+  volatile uint32_t ACPR;
+  volatile uint32_t SPPR;
+  volatile uint32_t FFCR;
+} TPI_Type;
+
+ITM_Type *swo_host_itm(void);
+extern CoreDebug_Type swo_host_core_debug;
+extern DWT_Type swo_host_dwt;
+extern TPI_Type swo_host_tpi;
+
+#define ITM                                 (swo_host_itm())
+#define CoreDebug                           (&swo_host_core_debug)
+#define DWT                                 (&swo_host_dwt)
+#define TPI                                 (&swo_host_tpi)
+
+#define ITM_TCR_ITMENA_Pos                  0U
+#define ITM_TCR_ITMENA_Msk                  (1UL << ITM_TCR_ITMENA_Pos)
+#define ITM_TCR_DWTENA_Pos                  3U
+#define CoreDebug_DHCSR_C_DEBUGEN_Msk       (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk          (1UL << 24)
+#define DWT_CTRL_NUMCOMP_Pos                28U
+#define DWT_CTRL_EXCTRCENA_Pos              16U
+#define DWT_CTRL_PCSAMPLENA_Pos             12U
+#define DWT_CTRL_CYCTAP_Pos                 9U
+#define DWT_CTRL_POSTINIT_Pos               5U
+#define DWT_CTRL_POSTPRESET_Pos             1U
+#define DWT_CTRL_CYCCNTENA_Pos              0U
+#define TPI_FFCR_TrigIn_Msk                 (1UL << 8)
+
+#endif // EM_DEVICE_H
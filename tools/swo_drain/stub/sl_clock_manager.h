@@ -0,0 +1,27 @@
+// Host stand-in for the clock manager used by sl_debug_swo_init()
+#ifndef SL_CLOCK_MANAGER_H
+#define SL_CLOCK_MANAGER_H
+
+#include <stdint.h>
+#include "sl_status.h"
+
+#define SL_BUS_CLOCK_GPIO                   0
+#define SL_CLOCK_BRANCH_TRACECLK            0
+// TRACECLK from HFRCOEM23 at its default band
+#define SWO_HOST_TRACECLK_HZ                19000000UL
+
+static inline sl_status_t sl_clock_manager_enable_bus_clock(int bus_clock)
+{
+  (void)bus_clock;
+  return SL_STATUS_OK;
+}
+
+static inline sl_status_t sl_clock_manager_get_clock_branch_frequency(int clock_branch,
+                                                                      uint32_t *frequency)
+{
+  (void)clock_branch;
+  *frequency = SWO_HOST_TRACECLK_HZ;
+  return SL_STATUS_OK;
+}
+
+#endif // SL_CLOCK_MANAGER_H
@@ -0,0 +1,7 @@
+// Host stand-in for the project component catalog
+#ifndef SL_COMPONENT_CATALOG_H
+#define SL_COMPONENT_CATALOG_H
+
+#define SL_CATALOG_CLOCK_MANAGER_PRESENT
+
+#endif // SL_COMPONENT_CATALOG_H
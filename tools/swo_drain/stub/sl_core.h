@@ -0,0 +1,9 @@
+// Host stand-in, the test is single threaded
+#ifndef SL_CORE_H
+#define SL_CORE_H
+
+#define CORE_DECLARE_IRQ_STATE              int core_irq_state_unused = 0
+#define CORE_ENTER_ATOMIC()                 (void)core_irq_state_unused
+#define CORE_EXIT_ATOMIC()                  (void)core_irq_state_unused
+
+#endif // SL_CORE_H
@@ -0,0 +1,10 @@
+// Host stand-in for the project SWO configuration. The project leaves the
+// buffer disabled, the Makefile sets the size and the SWO frequency.
+#ifndef SL_DEBUG_SWO_CONFIG_H
+#define SL_DEBUG_SWO_CONFIG_H
+
+#define SL_DEBUG_SWO_ENABLE                 1
+#define SL_DEBUG_SWO_SAMPLE_IRQ             0
+#define SL_DEBUG_SWO_SAMPLE_PC              0
+
+#endif // SL_DEBUG_SWO_CONFIG_H
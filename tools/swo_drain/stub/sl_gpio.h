@@ -0,0 +1,4 @@
+// Host stand-in, GPIO_SWV_PORT is not defined so nothing is used
+#ifndef SL_GPIO_H
+#define SL_GPIO_H
+#endif // SL_GPIO_H
@@ -0,0 +1,12 @@
+// Host stand-in for the GPIO HAL used by sl_debug_swo_init()
+#ifndef SL_HAL_GPIO_H
+#define SL_HAL_GPIO_H
+
+#include <stdbool.h>
+
+static inline void sl_hal_gpio_enable_debug_swo(bool enable)
+{
+  (void)enable;
+}
+
+#endif // SL_HAL_GPIO_H
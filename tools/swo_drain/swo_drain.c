@@ -0,0 +1,359 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test and drain rate model of the buffered SWO writes
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Usage: swo_drain
+//
+// Runs the SDK sl_debug_swo.c against host stand-ins of the ITM, checks the
+// buffered write path, then models how fast the main loop drains it. Each
+// ITM access takes HOST_ACCESS_NS of simulated time, and a stimulus port
+// reads busy until the SWO line has sent the previous packet: 2 bytes for a
+// byte write and 5 for a word write, 10 bits each at SL_DEBUG_SWO_FREQ. The
+// ITM FIFO is taken to hold a single packet, which makes the model
+// conservative: a real one accepts a few more writes per call.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "em_device.h"
+#include "sl_debug_swo.h"
+
+// -----------------------------------------------------------------------------
+// Private macros
+
+#define HOST_CHANNELS           32
+// Channels whose data is checked
+#define HOST_TRACKED            4
+#define HOST_STREAM_MAX         (1UL << 20)
+#define HOST_ACCESS_NS          100ULL
+#define HOST_BYTE_NS            (10ULL * 1000000000ULL / SL_DEBUG_SWO_FREQ)
+#define HOST_DURATION_NS        1000000000ULL
+
+// -----------------------------------------------------------------------------
+// Private types
+
+typedef struct {
+  uint8_t data[HOST_STREAM_MAX];
+  uint32_t queued;                // bytes accepted by sl_debug_swo_write_buffered()
+  uint32_t received;              // bytes written to the stimulus port
+} stream_t;
+
+typedef struct {
+  const char *name;
+  uint32_t loop_us;               // main loop period while data is queued
+  uint32_t write_bytes;           // size of each write
+  uint32_t write_interval_us;     // time between writes
+} scenario_t;
+
+// -----------------------------------------------------------------------------
+// Private variables
+
+static ITM_Type itm;
+CoreDebug_Type swo_host_core_debug;
+DWT_Type swo_host_dwt;
+TPI_Type swo_host_tpi;
+
+static uint32_t port_value[HOST_CHANNELS]; // value left in each port by the model
+static stream_t streams[HOST_TRACKED];
+static uint64_t now_ns;
+static uint64_t wire_free_ns;      // end of the packet on the line
+static uint64_t wire_busy_ns;      // line time spent sending packets
+static uint32_t mismatches;        // bytes written out of order or corrupted
+static uint32_t busy_writes;       // writes to a port reading busy
+static uint32_t failures;
+
+static const scenario_t scenarios[] = {
+  { "log line every 10 ms, loop 100 us",  100,  64, 10000 },
+  { "trace 16 B every 1 ms, loop 20 us",   20,  16,  1000 },
+  { "trace 16 B every 1 ms, loop 200 us", 200,  16,  1000 },
+  { "trace 16 B every 250 us, loop 20 us", 20,  16,   250 },
+  { "trace 4 B every 50 us, loop 20 us",   20,   4,    50 },
+};
+
+// -----------------------------------------------------------------------------
+// ITM model
+
+static void port_written(uint32_t channel, uint32_t value, uint32_t before)
+{
+  // A byte write leaves the upper bytes of the port as the model set them.
+  unsigned int width = ((value ^ before) & 0xFFFFFF00UL) ? 4 : 1;
+
+  if (before == 0) {
+    busy_writes++;
+  }
+  wire_free_ns = ((wire_free_ns > now_ns) ? wire_free_ns : now_ns)
+                 + (width + 1) * HOST_BYTE_NS;
+  wire_busy_ns += (width + 1) * HOST_BYTE_NS;
+  if (channel >= HOST_TRACKED) {
+    return;
+  }
+  for (unsigned int i = 0; i < width; i++) {
+    stream_t *s = &streams[channel];
+    uint8_t byte = (uint8_t)(value >> (8 * i));
+    if ((s->received >= s->queued) || (s->data[s->received % HOST_STREAM_MAX] != byte)) {
+      mismatches++;
+    }
+    s->received++;
+  }
+}
+
+// Leave a value in each port that reads ready or busy, and that differs in
+// every byte from the data expected next, so that any write shows.
+static void port_arm(uint32_t channel)
+{
+  uint32_t expected = 0;
+  uint32_t value;
+
+  if (now_ns < wire_free_ns) {
+    value = 0;
+  } else {
+    if (channel < HOST_TRACKED) {
+      stream_t *s = &streams[channel];
+      for (unsigned int i = 0; (i < 4) && (s->received + i < s->queued); i++) {
+        expected |= (uint32_t)s->data[(s->received + i) % HOST_STREAM_MAX] << (8 * i);
+      }
+    }
+    value = expected ^ 0x01010101UL;
+    if (value == 0) {
+      value = expected ^ 0x02020202UL;
+    }
+  }
+  port_value[channel] = value;
+  itm.PORT[channel].u32 = value;
+}
+
+// Take in the writes since the last access and set the ports for the next
+static void port_sync(void)
+{
+  for (uint32_t i = 0; i < HOST_CHANNELS; i++) {
+    if (itm.PORT[i].u32 != port_value[i]) {
+      port_written(i, itm.PORT[i].u32, port_value[i]);
+    }
+    port_arm(i);
+  }
+}
+
+ITM_Type *swo_host_itm(void)
+{
+  now_ns += HOST_ACCESS_NS;
+  port_sync();
+  return &itm;
+}
+
+// -----------------------------------------------------------------------------
+// Test helpers
+
+static void check(const char *name, bool ok)
+{
+  printf("check %-40s %s\n", name, ok ? "ok" : "FAIL");
+  if (!ok) {
+    failures++;
+  }
+}
+
+static sl_status_t queue(uint32_t channel, uint32_t length)
+{
+  static uint8_t pattern = 0;
+  uint8_t data[1024] = { 0 };
+  stream_t *s = &streams[channel];
+  sl_status_t sc;
+
+  for (uint32_t i = 0; i < length; i++) {
+    data[i] = pattern++;
+  }
+  sc = sl_debug_swo_write_buffered(channel, data, length);
+  if (sc == SL_STATUS_OK) {
+    for (uint32_t i = 0; i < length; i++) {
+      s->data[(s->queued + i) % HOST_STREAM_MAX] = data[i];
+    }
+    s->queued += length;
+  }
+  return sc;
+}
+
+static void drain(void)
+{
+  while (!sl_debug_swo_is_ok_to_sleep()) {
+    sl_debug_swo_process_action();
+  }
+}
+
+static bool streams_done(void)
+{
+  port_sync();
+  for (unsigned int i = 0; i < HOST_TRACKED; i++) {
+    if (streams[i].received != streams[i].queued) {
+      return false;
+    }
+  }
+  return (mismatches == 0) && (busy_writes == 0);
+}
+
+// -----------------------------------------------------------------------------
+// Checks
+
+static void run_checks(void)
+{
+  uint32_t dropped;
+  uint32_t accepted;
+  uint32_t channel8_busy;
+
+  port_sync();
+
+  check("buffered write before init", queue(0, 8) == SL_STATUS_NOT_INITIALIZED);
+
+  channel8_busy = (uint32_t)wire_busy_ns;
+  check("init", (sl_debug_swo_init() == SL_STATUS_OK)
+        && (itm.TCR & ITM_TCR_ITMENA_Msk)
+        && (wire_busy_ns - channel8_busy == 2 * HOST_BYTE_NS));
+
+  // Some J-Link versions disable trace when the debugger disconnects.
+  swo_host_core_debug.DEMCR = 0;
+  itm.TER = 0;
+  streams[0].data[streams[0].queued++] = 'x';
+  check("blocking write re-enables trace",
+        (sl_debug_swo_write_u8(0, 'x') == SL_STATUS_OK)
+        && (swo_host_core_debug.DEMCR & CoreDebug_DEMCR_TRCENA_Msk)
+        && (itm.TER & 1UL)
+        && streams_done());
+
+  queue(0, 3);
+  queue(1, 4);
+  queue(0, 5);
+  queue(2, 1);
+  queue(1, 7);
+  drain();
+  check("channels keep their order", streams_done());
+
+  itm.TER = 0;
+  queue(3, 20);
+  drain();
+  check("buffered write re-enables the port", (itm.TER & (1UL << 3)) && streams_done());
+
+  check("write split into records", queue(1, 600) == SL_STATUS_OK);
+  drain();
+  check("split write received", streams_done());
+
+  dropped = sl_debug_swo_get_dropped_count();
+  accepted = 0;
+  while (queue(2, 100) == SL_STATUS_OK) {
+    accepted += 100;
+  }
+  check("full buffer drops and counts the write",
+        (sl_debug_swo_get_dropped_count() - dropped == 100)
+        && (accepted + 100 > SL_DEBUG_SWO_BUFFER_SIZE)
+        && !sl_debug_swo_is_ok_to_sleep());
+  drain();
+  check("full buffer drained", streams_done());
+
+  dropped = sl_debug_swo_get_dropped_count();
+  queue(0, 50);
+  queue(1, 30);
+  itm.TCR = 0;
+  check("disabled ITM allows sleep", sl_debug_swo_is_ok_to_sleep());
+  sl_debug_swo_process_action();
+  itm.TCR = ITM_TCR_ITMENA_Msk;
+  check("disabled ITM discards and counts",
+        (sl_debug_swo_get_dropped_count() - dropped == 80)
+        && sl_debug_swo_is_ok_to_sleep());
+  // The discarded data never reaches the port.
+  streams[0].queued -= 50;
+  streams[1].queued -= 30;
+
+  for (uint32_t i = 0; i < 2000; i++) {
+    if (queue(i & 3, 1 + (i * 37) % 200) != SL_STATUS_OK) {
+      drain();
+    }
+    if ((i & 7) == 0) {
+      sl_debug_swo_process_action();
+    }
+  }
+  drain();
+  check("indexes wrap", streams_done());
+}
+
+// -----------------------------------------------------------------------------
+// Drain rate model
+
+static void run_scenario(const scenario_t *scenario)
+{
+  uint64_t start = now_ns;
+  uint64_t end = now_ns + HOST_DURATION_NS;
+  uint64_t next_write = now_ns;
+  uint64_t next_loop = now_ns;
+  uint64_t wire_start = wire_busy_ns;
+  uint32_t dropped = sl_debug_swo_get_dropped_count();
+  uint32_t received = streams[1].received;
+  uint32_t offered = 0;
+  uint32_t backlog_max = 0;
+
+  while (now_ns < end) {
+    if (next_write <= next_loop) {
+      if (now_ns < next_write) {
+        now_ns = next_write;
+      }
+      (void)queue(1, scenario->write_bytes);
+      offered += scenario->write_bytes;
+      next_write += scenario->write_interval_us * 1000ULL;
+    } else {
+      if (now_ns < next_loop) {
+        now_ns = next_loop;
+      }
+      sl_debug_swo_process_action();
+      next_loop = now_ns + scenario->loop_us * 1000ULL;
+    }
+    port_sync();
+    if (streams[1].queued - streams[1].received > backlog_max) {
+      backlog_max = streams[1].queued - streams[1].received;
+    }
+  }
+
+  printf("%s\n", scenario->name);
+  printf("  offered    %6lu B/s\n", (unsigned long)offered);
+  printf("  delivered  %6lu B/s\n", (unsigned long)(streams[1].received - received));
+  printf("  dropped    %6lu B\n", (unsigned long)(sl_debug_swo_get_dropped_count() - dropped));
+  printf("  backlog    %6lu B max\n", (unsigned long)backlog_max);
+  printf("  line busy  %6lu %%\n\n",
+         (unsigned long)((wire_busy_ns - wire_start) * 100 / (now_ns - start)));
+  drain();
+}
+
+int main(void)
+{
+  run_checks();
+  printf("\nbuffer %u B, SWO %lu Hz\n\n",
+         (unsigned int)SL_DEBUG_SWO_BUFFER_SIZE,
+         (unsigned long)SL_DEBUG_SWO_FREQ);
+  for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+    run_scenario(&scenarios[i]);
+  }
+  check("model data intact", streams_done());
+  return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,9 @@
+// Host stand-in for the application assert used by tx_power.c
+#ifndef APP_ASSERT_H
+#define APP_ASSERT_H
+
+#include <assert.h>
+
+#define app_assert_status(sc)               assert((sc) == SL_STATUS_OK)
+
+#endif // APP_ASSERT_H
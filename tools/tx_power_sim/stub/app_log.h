@@ -0,0 +1,12 @@
+// Host stand-in for the application log used by tx_power.c
+#ifndef APP_LOG_H
+#define APP_LOG_H
+
+#include <stdio.h>
+
+#define APP_LOG_NL                          "\n"
+#define app_log_info(...)                   printf("  log: " __VA_ARGS__)
+#define app_log_debug(...)                  ((void)0)
+#define app_log_status_error_f(sc, ...)     printf("  error 0x%04x: " __VA_ARGS__, (unsigned int)(sc))
+
+#endif // APP_LOG_H
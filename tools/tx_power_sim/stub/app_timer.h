@@ -0,0 +1,25 @@
+// Host stand-in for the application timer used by tx_power.c
+#ifndef APP_TIMER_H
+#define APP_TIMER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sl_bluetooth.h"
+
+typedef struct app_timer app_timer_t;
+typedef void (*app_timer_callback_t)(app_timer_t *timer, void *data);
+
+struct app_timer {
+  app_timer_callback_t callback;
+  void *callback_data;
+  bool running;
+};
+
+sl_status_t app_timer_start(app_timer_t *timer,
+                            uint32_t timeout_ms,
+                            app_timer_callback_t callback,
+                            void *callback_data,
+                            bool is_periodic);
+sl_status_t app_timer_stop(app_timer_t *timer);
+
+#endif // APP_TIMER_H
@@ -0,0 +1,45 @@
+// Host stand-in for the parts of the Bluetooth API used by tx_power.c
+#ifndef SL_BLUETOOTH_H
+#define SL_BLUETOOTH_H
+
+#include <stdint.h>
+
+typedef uint32_t sl_status_t;
+#define SL_STATUS_OK                           ((sl_status_t)0x0000)
+#define SL_STATUS_FAIL                         ((sl_status_t)0x0001)
+
+#define SL_BT_MSG_ID(hdr)                      ((hdr) & 0xffff00f8)
+#define SL_BT_CONNECTION_TX_POWER_UNAVAILABLE  0x7f
+
+enum {
+  sl_bt_evt_connection_opened_id   = 0x000600a0,
+  sl_bt_evt_connection_closed_id   = 0x010600a0,
+  sl_bt_evt_connection_tx_power_id = 0x0a0600a0,
+};
+
+typedef struct {
+  uint32_t header;
+  union {
+    struct {
+      uint8_t connection;
+    } evt_connection_opened;
+    struct {
+      uint16_t reason;
+      uint8_t connection;
+    } evt_connection_closed;
+    struct {
+      uint8_t connection;
+      uint8_t phy;
+      int8_t power_level;
+      int8_t power_level_flag;
+      int8_t delta;
+    } evt_connection_tx_power;
+  } data;
+} sl_bt_msg_t;
+
+sl_status_t sl_bt_connection_get_median_rssi(uint8_t connection, int8_t *rssi);
+sl_status_t sl_bt_connection_set_tx_power(uint8_t connection,
+                                          int16_t tx_power,
+                                          int16_t *tx_power_out);
+
+#endif // SL_BLUETOOTH_H
@@ -0,0 +1,209 @@
+/***************************************************************************//**
+ * @file
+ * @brief Simulate the connection TX power manager over RSSI traces
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Usage: tx_power_sim [-a <dB>] <trace>...
+//
+// A trace holds the median RSSI of one connection in dBm, one sample per
+// line at the TX power manager sampling period. Lines starting with '#' are
+// comments. Each trace is replayed as one connection through the firmware
+// tx_power.c, with the Bluetooth stack and the application timer stubbed.
+//
+// The margin at the central is computed from the link budget model of
+// tx_power.c, with the path towards the central -a dB weaker than the one
+// from it. A positive value shows how an asymmetric link or a central
+// transmitting above TX_POWER_PEER_ASSUMED eats into the target margin.
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// The firmware module under test, built with the stub headers
+#include "../../base/tx_power.c"
+
+#define SIM_CONNECTION                 1
+#define SIM_LINE_MAX                   128
+
+// -----------------------------------------------------------------------------
+// Stack and timer stubs
+
+static int8_t sim_rssi;
+static int16_t sim_power;
+static uint32_t sim_changes;
+
+sl_status_t sl_bt_connection_get_median_rssi(uint8_t connection, int8_t *rssi)
+{
+  (void)connection;
+  *rssi = sim_rssi;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_connection_set_tx_power(uint8_t connection,
+                                          int16_t tx_power,
+                                          int16_t *tx_power_out)
+{
+  (void)connection;
+  if (tx_power != sim_power) {
+    sim_changes++;
+  }
+  sim_power = tx_power;
+  *tx_power_out = tx_power;
+  return SL_STATUS_OK;
+}
+
+sl_status_t app_timer_start(app_timer_t *timer,
+                            uint32_t timeout_ms,
+                            app_timer_callback_t callback,
+                            void *callback_data,
+                            bool is_periodic)
+{
+  (void)timeout_ms;
+  assert(is_periodic);
+  timer->callback = callback;
+  timer->callback_data = callback_data;
+  timer->running = true;
+  return SL_STATUS_OK;
+}
+
+sl_status_t app_timer_stop(app_timer_t *timer)
+{
+  timer->running = false;
+  return SL_STATUS_OK;
+}
+
+// -----------------------------------------------------------------------------
+// Simulation
+
+static void sim_event(uint32_t id)
+{
+  sl_bt_msg_t evt = { .header = id };
+
+  if (id == sl_bt_evt_connection_opened_id) {
+    evt.data.evt_connection_opened.connection = SIM_CONNECTION;
+  } else {
+    evt.data.evt_connection_closed.connection = SIM_CONNECTION;
+  }
+  tx_power_on_event(&evt);
+}
+
+static int sim_trace(const char *path, int asymmetry)
+{
+  char line[SIM_LINE_MAX];
+  FILE *f = fopen(path, "r");
+  uint32_t samples = 0;
+  uint32_t below_target = 0;
+  uint32_t below_zero = 0;
+  int64_t power_sum = 0;
+  int32_t margin_min = INT32_MAX;
+
+  if (f == NULL) {
+    fprintf(stderr, "%s: %s\n", path, strerror(errno));
+    return -1;
+  }
+  printf("%s, asymmetry %d dB\n", path, asymmetry);
+
+  sim_power = 0;
+  sim_changes = 0;
+  sim_event(sl_bt_evt_connection_opened_id);
+  // Count the adjustments, not the initial setting.
+  sim_changes = 0;
+
+  while (fgets(line, sizeof(line), f) != NULL) {
+    char *end;
+    long rssi;
+    int32_t margin;
+
+    if ((line[0] == '#') || (line[strspn(line, " \t\r\n")] == '\0')) {
+      continue;
+    }
+    rssi = strtol(line, &end, 10);
+    if ((end == line) || (rssi < INT8_MIN) || (rssi > INT8_MAX)) {
+      fprintf(stderr, "%s: bad sample: %s", path, line);
+      fclose(f);
+      return -1;
+    }
+    sim_rssi = (int8_t)rssi;
+    if (sample_timer.running) {
+      sample_timer.callback(&sample_timer, sample_timer.callback_data);
+    }
+
+    // Margin at the central in 0.1 dB after this sample's decision
+    margin = sim_power - TX_POWER_PEER_ASSUMED + (int32_t)rssi * 10
+             - asymmetry * 10 - TX_POWER_PEER_SENSITIVITY * 10;
+    if (margin < margin_min) {
+      margin_min = margin;
+    }
+    if (margin < TX_POWER_TARGET_MARGIN * 10) {
+      below_target++;
+    }
+    if (margin < 0) {
+      below_zero++;
+    }
+    power_sum += sim_power;
+    samples++;
+  }
+  fclose(f);
+
+  sim_event(sl_bt_evt_connection_closed_id);
+  if (samples == 0) {
+    printf("  no samples\n\n");
+    return 0;
+  }
+  printf("  samples              %lu\n", (unsigned long)samples);
+  printf("  average TX power     %.1f dBm (%.1f dB below maximum)\n",
+         (double)power_sum / samples / 10.0,
+         (SL_BT_CONFIG_MAX_TX_POWER - (double)power_sum / samples) / 10.0);
+  printf("  power changes        %lu\n", (unsigned long)sim_changes);
+  printf("  minimum margin       %.1f dB\n", margin_min / 10.0);
+  printf("  below target margin  %lu samples\n", (unsigned long)below_target);
+  printf("  below sensitivity    %lu samples\n\n", (unsigned long)below_zero);
+  return 0;
+}
+
+int main(int argc, char *argv[])
+{
+  int asymmetry = 0;
+  int first = 1;
+
+  if ((argc > 2) && (strcmp(argv[1], "-a") == 0)) {
+    asymmetry = atoi(argv[2]);
+    first = 3;
+  }
+  if (first >= argc) {
+    fprintf(stderr, "usage: %s [-a <dB>] <trace>...\n", argv[0]);
+    return 2;
+  }
+  for (int i = first; i < argc; i++) {
+    if (sim_trace(argv[i], asymmetry) != 0) {
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,11 @@
+// Host stand-in, the core clock of the test
+#ifndef EM_DEVICE_H
+#define EM_DEVICE_H
+
+#include <stdint.h>
+
+#define __CORTEX_M                          33U
+
+uint32_t SystemCoreClockGet(void);
+
+#endif // EM_DEVICE_H
@@ -0,0 +1,14 @@
+// Host stand-in, the test is single threaded and sets the interrupt state
+#ifndef SL_CORE_H
+#define SL_CORE_H
+
+#include <stdbool.h>
+
+extern bool udelay_host_in_irq;
+extern bool udelay_host_irq_disabled;
+
+#define CORE_IN_IRQ_CONTEXT()               (udelay_host_in_irq)
+#define CORE_IRQ_DISABLED()                 (udelay_host_irq_disabled)
+#define CORE_ATOMIC_SECTION(yourcode)       { yourcode }
+
+#endif // SL_CORE_H
@@ -0,0 +1,7 @@
+// Host stand-in, sleeping advances the simulated time to the next wakeup
+#ifndef SL_POWER_MANAGER_H
+#define SL_POWER_MANAGER_H
+
+void sl_power_manager_sleep(void);
+
+#endif // SL_POWER_MANAGER_H
@@ -0,0 +1,46 @@
+// Host stand-in of the sleeptimer on a simulated 32768 Hz tick. The handle
+// has the fields of the SDK one, so the size check of sl_udelay.c still holds.
+#ifndef SL_SLEEPTIMER_H
+#define SL_SLEEPTIMER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sl_status.h"
+
+typedef struct sl_sleeptimer_timer_handle sl_sleeptimer_timer_handle_t;
+
+typedef void (*sl_sleeptimer_timer_callback_t)(sl_sleeptimer_timer_handle_t *handle,
+                                               void *data);
+
+struct sl_sleeptimer_timer_handle {
+  void *callback_data;
+  uint8_t priority;
+  uint16_t option_flags;
+  sl_sleeptimer_timer_handle_t *next;
+  sl_sleeptimer_timer_callback_t callback;
+  uint32_t timeout_periodic;
+  uint32_t delta;
+  uint32_t timeout_expected_tc;           // host: tick count of the expiry
+  uint16_t conversion_error;
+  uint16_t accumulated_error;
+};
+
+uint32_t sl_sleeptimer_get_timer_frequency(void);
+
+sl_status_t sl_sleeptimer_start_timer(sl_sleeptimer_timer_handle_t *handle,
+                                      uint32_t timeout,
+                                      sl_sleeptimer_timer_callback_t callback,
+                                      void *callback_data,
+                                      uint8_t priority,
+                                      uint16_t option_flags);
+
+sl_status_t sl_sleeptimer_restart_timer(sl_sleeptimer_timer_handle_t *handle,
+                                        uint32_t timeout,
+                                        sl_sleeptimer_timer_callback_t callback,
+                                        void *callback_data,
+                                        uint8_t priority,
+                                        uint16_t option_flags);
+
+sl_status_t sl_sleeptimer_stop_timer(sl_sleeptimer_timer_handle_t *handle);
+
+#endif // SL_SLEEPTIMER_H
@@ -0,0 +1,371 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of the timed microsecond delays
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Usage: udelay_accuracy
+//
+// Runs the SDK sl_udelay.c against a simulated 32768 Hz sleeptimer and power
+// manager. Sleeping advances the simulated time to the next timer expiry, or
+// to the next unrelated wakeup when HOST_WAKE_NS is set, and the busy loop
+// advances it by HW_LOOP_CYCLE core cycles per loop at HOST_CORE_HZ. Each
+// delay is started at several phases of the sleeptimer tick and the report
+// lists how long it really took.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "em_device.h"
+#include "sl_udelay.h"
+#include "sl_sleeptimer.h"
+#include "sl_power_manager.h"
+
+// -----------------------------------------------------------------------------
+// Private macros
+
+#define HOST_CORE_HZ            38400000ULL
+#define HOST_TIMER_HZ           32768ULL
+#define HOST_LOOP_CYCLES        3ULL
+#define HOST_TIMERS             4
+// Longest tick, the tick time is not a whole number of nanoseconds
+#define HOST_TICK_NS            ((1000000000ULL + HOST_TIMER_HZ - 1) / HOST_TIMER_HZ)
+#define HOST_PHASES             5
+
+// -----------------------------------------------------------------------------
+// Private variables
+
+bool udelay_host_in_irq;
+bool udelay_host_irq_disabled;
+
+static uint64_t now_ns;
+static sl_sleeptimer_timer_handle_t *timers[HOST_TIMERS];
+static uint64_t wake_ns;          // interval of unrelated wakeups, 0 for none
+static bool wake_before_sleep;    // next timer expires before the core sleeps
+static uint32_t sleeps;
+static uint32_t asserts;
+static uint32_t callbacks;
+static uint32_t failures;
+
+static const unsigned delays_us[] = { 10, 50, 99, 100, 200, 500, 1000, 5000, 50000 };
+
+// Start phases in the sleeptimer tick, in quarters of a tick. The last one
+// starts a nanosecond before the next tick.
+static const uint64_t phases[HOST_PHASES] = { 0, 1, 2, 3, 4 };
+
+// -----------------------------------------------------------------------------
+// Host stand-ins
+
+uint32_t SystemCoreClockGet(void)
+{
+  return (uint32_t)HOST_CORE_HZ;
+}
+
+void udelay_host_assert(bool ok)
+{
+  if (!ok) {
+    asserts++;
+  }
+}
+
+void sli_delay_loop(unsigned n)
+{
+  now_ns += (uint64_t)n * HOST_LOOP_CYCLES * 1000000000ULL / HOST_CORE_HZ;
+}
+
+static uint64_t tick_count(void)
+{
+  return now_ns * HOST_TIMER_HZ / 1000000000ULL;
+}
+
+static uint64_t tick_time(uint64_t tick)
+{
+  return (tick * 1000000000ULL + HOST_TIMER_HZ - 1) / HOST_TIMER_HZ;
+}
+
+uint32_t sl_sleeptimer_get_timer_frequency(void)
+{
+  return (uint32_t)HOST_TIMER_HZ;
+}
+
+sl_status_t sl_sleeptimer_stop_timer(sl_sleeptimer_timer_handle_t *handle)
+{
+  for (size_t i = 0; i < HOST_TIMERS; i++) {
+    if (timers[i] == handle) {
+      timers[i] = NULL;
+      return SL_STATUS_OK;
+    }
+  }
+  return SL_STATUS_INVALID_STATE;
+}
+
+sl_status_t sl_sleeptimer_start_timer(sl_sleeptimer_timer_handle_t *handle,
+                                      uint32_t timeout,
+                                      sl_sleeptimer_timer_callback_t callback,
+                                      void *callback_data,
+                                      uint8_t priority,
+                                      uint16_t option_flags)
+{
+  for (size_t i = 0; i < HOST_TIMERS; i++) {
+    if (timers[i] == handle) {
+      return SL_STATUS_INVALID_STATE;
+    }
+  }
+  for (size_t i = 0; i < HOST_TIMERS; i++) {
+    if (timers[i] == NULL) {
+      handle->callback = callback;
+      handle->callback_data = callback_data;
+      handle->priority = priority;
+      handle->option_flags = option_flags;
+      handle->timeout_expected_tc = (uint32_t)(tick_count() + timeout);
+      timers[i] = handle;
+      return SL_STATUS_OK;
+    }
+  }
+  return SL_STATUS_NO_MORE_RESOURCE;
+}
+
+sl_status_t sl_sleeptimer_restart_timer(sl_sleeptimer_timer_handle_t *handle,
+                                        uint32_t timeout,
+                                        sl_sleeptimer_timer_callback_t callback,
+                                        void *callback_data,
+                                        uint8_t priority,
+                                        uint16_t option_flags)
+{
+  (void)sl_sleeptimer_stop_timer(handle);
+  return sl_sleeptimer_start_timer(handle, timeout, callback, callback_data,
+                                   priority, option_flags);
+}
+
+// Earliest running timer, or -1
+static int next_timer(void)
+{
+  int next = -1;
+  for (int i = 0; i < HOST_TIMERS; i++) {
+    if ((timers[i] != NULL)
+        && ((next < 0) || (timers[i]->timeout_expected_tc < timers[next]->timeout_expected_tc))) {
+      next = i;
+    }
+  }
+  return next;
+}
+
+static bool timers_idle(void)
+{
+  return next_timer() < 0;
+}
+
+// Run the interrupt of the earliest timer at its expiry
+static void fire_timer(int i)
+{
+  sl_sleeptimer_timer_handle_t *handle = timers[i];
+  uint64_t expiry_ns = tick_time(handle->timeout_expected_tc);
+  if (expiry_ns > now_ns) {
+    now_ns = expiry_ns;
+  }
+  timers[i] = NULL;
+  udelay_host_in_irq = true;
+  handle->callback(handle, handle->callback_data);
+  udelay_host_in_irq = false;
+}
+
+void sl_power_manager_sleep(void)
+{
+  int next = next_timer();
+
+  sleeps++;
+  if (wake_before_sleep && (next >= 0)) {
+    // The timer interrupt runs between the caller's last check and the
+    // power manager masking interrupts, the core then sleeps regardless
+    wake_before_sleep = false;
+    fire_timer(next);
+    next = next_timer();
+  }
+  if (wake_ns != 0) {
+    uint64_t wake = (now_ns / wake_ns + 1) * wake_ns;
+    if ((next < 0) || (wake < tick_time(timers[next]->timeout_expected_tc))) {
+      now_ns = wake;
+      return;
+    }
+  }
+  if (next < 0) {
+    printf("sleep without a wakeup at %llu ns\n", (unsigned long long)now_ns);
+    exit(1);
+  }
+  fire_timer(next);
+}
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+static void check(const char *name, bool ok)
+{
+  printf("check %-40s %s\n", name, ok ? "ok" : "FAILED");
+  if (!ok) {
+    failures++;
+  }
+}
+
+static void start_at_phase(uint64_t phase)
+{
+  uint64_t tick = tick_count() + 2;
+  now_ns = tick_time(tick) + (tick_time(tick + 1) - tick_time(tick)) * phase / 4;
+  if (phase == 4) {
+    now_ns--;
+  }
+}
+
+static uint64_t sleep_ns(unsigned us)
+{
+  uint64_t start = now_ns;
+  sl_udelay_sleep(us);
+  return now_ns - start;
+}
+
+static uint64_t wait_ns(unsigned us)
+{
+  uint64_t start = now_ns;
+  sl_udelay_wait(us);
+  return now_ns - start;
+}
+
+static void delay_done(void *data)
+{
+  *(uint64_t *)data = now_ns;
+  callbacks++;
+}
+
+static void run_report(void)
+{
+  bool early = false;
+  bool late = false;
+  bool stopped = true;
+  bool busy = true;
+  bool counted = true;
+
+  printf("\ncore %llu Hz, sleeptimer %llu Hz, timed from %u us\n\n",
+         (unsigned long long)HOST_CORE_HZ, (unsigned long long)HOST_TIMER_HZ,
+         (unsigned int)SL_UDELAY_TIMER_MIN_US);
+  printf("     delay       busy     slept min  slept max  overshoot  sleeps\n");
+  for (size_t d = 0; d < sizeof(delays_us) / sizeof(delays_us[0]); d++) {
+    unsigned us = delays_us[d];
+    uint64_t min = UINT64_MAX;
+    uint64_t max = 0;
+    uint32_t sleeps_max = 0;
+    for (size_t p = 0; p < HOST_PHASES; p++) {
+      uint32_t saved = sl_udelay_get_saved_us();
+      uint64_t elapsed;
+      start_at_phase(phases[p]);
+      sleeps = 0;
+      elapsed = sleep_ns(us);
+      min = (elapsed < min) ? elapsed : min;
+      max = (elapsed > max) ? elapsed : max;
+      sleeps_max = (sleeps > sleeps_max) ? sleeps : sleeps_max;
+      early |= elapsed < us * 1000ULL;
+      late |= elapsed > us * 1000ULL + 2 * HOST_TICK_NS;
+      stopped &= timers_idle();
+      busy &= (us >= SL_UDELAY_TIMER_MIN_US) || (sleeps == 0);
+      counted &= sl_udelay_get_saved_us() - saved == ((us >= SL_UDELAY_TIMER_MIN_US) ? us : 0);
+    }
+    printf("  %6u us  %8.1f us  %8.1f us %8.1f us  %6.1f %%  %6u\n",
+           us, wait_ns(us) / 1000.0, min / 1000.0, max / 1000.0,
+           (max - us * 1000.0) * 100.0 / (us * 1000.0), (unsigned int)sleeps_max);
+  }
+  printf("\n");
+  check("timed delay never early", !early);
+  check("timed delay at most two ticks late", !late);
+  check("timer stopped after the delay", stopped);
+  check("delay below the minimum busy waits", busy);
+  check("slept time counted", counted);
+}
+
+static void run_checks(void)
+{
+  uint64_t reference;
+  uint64_t elapsed;
+  uint64_t done;
+  sl_udelay_timer_t timer;
+
+  // The timer interrupt runs just before the core sleeps: the delay ends one
+  // tick later, on the expiry the callback re-armed, instead of never
+  start_at_phase(1);
+  reference = sleep_ns(500);
+  start_at_phase(1);
+  wake_before_sleep = true;
+  elapsed = sleep_ns(500);
+  check("wakeup before sleep costs a tick",
+        !wake_before_sleep && (elapsed > reference)
+        && (elapsed <= reference + HOST_TICK_NS) && timers_idle());
+
+  // Other interrupts wake the core, the delay sleeps again
+  start_at_phase(1);
+  wake_ns = 20000;
+  sleeps = 0;
+  elapsed = sleep_ns(500);
+  wake_ns = 0;
+  // Same phase as the reference, the tick length may differ by a nanosecond
+  check("other wakeups sleep again",
+        (elapsed + 1 >= reference) && (elapsed <= reference + 1) && (sleeps > 1));
+
+  sleeps = 0;
+  udelay_host_in_irq = true;
+  elapsed = sleep_ns(500);
+  udelay_host_in_irq = false;
+  check("delay in interrupt busy waits", (sleeps == 0) && (elapsed >= 500000));
+
+  udelay_host_irq_disabled = true;
+  elapsed = sleep_ns(500);
+  udelay_host_irq_disabled = false;
+  check("delay with interrupts masked busy waits", (sleeps == 0) && (elapsed >= 500000));
+
+  start_at_phase(2);
+  reference = now_ns;
+  done = 0;
+  callbacks = 0;
+  check("started delay", sl_udelay_start(&timer, 500, delay_done, &done) == SL_STATUS_OK);
+  check("started delay still running", (callbacks == 0) && !timers_idle());
+  fire_timer(next_timer());
+  check("started delay calls back once after it",
+        (callbacks == 1) && timers_idle() && (done - reference >= 500000)
+        && (done - reference <= 500000 + 2 * HOST_TICK_NS));
+
+  reference = now_ns;
+  done = 0;
+  callbacks = 0;
+  check("short started delay calls back at once",
+        (sl_udelay_start(&timer, 20, delay_done, &done) == SL_STATUS_OK)
+        && (callbacks == 1) && timers_idle() && (done - reference >= 20000));
+}
+
+int main(void)
+{
+  run_report();
+  run_checks();
+  check("no assertion", asserts == 0);
+  return (failures == 0) ? 0 : 1;
+}
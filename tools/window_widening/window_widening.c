@@ -0,0 +1,135 @@
+/***************************************************************************//**
+ * @file
+ * @brief Model the connection window widening for a sleep clock accuracy
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Usage: window_widening [-c <ppm>] <ppm>...
+//
+// A peripheral that slept since the last anchor point opens its receive
+// window early by the window widening of the Bluetooth Core specification,
+// Vol 6, Part B, 4.5.7:
+//
+//   widening = (central SCA + peripheral SCA) / 1000000 * time since anchor
+//
+// where the peripheral SCA is the sleep clock accuracy the link layer was
+// given, CMU_LFXOPrecisionSet() for the LFXO. The central is on time on
+// average, so the receiver listens for the widening on top of every event.
+// For each peripheral accuracy on the command line and -c for the central
+// (50 ppm by default) the model prints the extra receive time and current,
+// and the widening over a set of connection intervals and peripheral
+// latencies, flagging the ones over the limit of half the interval.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// -----------------------------------------------------------------------------
+// Private macros
+
+// Receive current, EFR32BG22 datasheet typical, 1 Mbps GFSK at 3.0 V
+#define WW_RX_CURRENT_UA        3600.0
+// Inter frame space, the widening must stay below half the interval minus it
+#define WW_T_IFS_US             150.0
+#define WW_CENTRAL_PPM_DEFAULT  50
+// Connection interval unit in us
+#define WW_CONN_UNIT_US         1250.0
+
+// -----------------------------------------------------------------------------
+// Private variables
+
+// Connection intervals in 1.25 ms units: 7.5 ms, 30 ms, 100 ms, 1 s, 4 s
+static const unsigned int intervals[] = { 6, 24, 80, 800, 3200 };
+static const unsigned int latencies[] = { 0, 4 };
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+static int parse_ppm(const char *arg, unsigned long *ppm)
+{
+  char *end;
+
+  *ppm = strtoul(arg, &end, 10);
+  if ((end == arg) || (*end != '\0') || (*ppm > 65535)) {
+    fprintf(stderr, "bad accuracy: %s\n", arg);
+    return -1;
+  }
+  return 0;
+}
+
+static void report(unsigned long central_ppm, unsigned long local_ppm)
+{
+  // The widening grows with the time since the anchor as fast as the events
+  // spread out, so the extra listening per second does not depend on the
+  // interval or the latency.
+  double duty = (double)(central_ppm + local_ppm) / 1000000.0;
+
+  printf("peripheral %lu ppm, central %lu ppm: extra RX %.4f %%, %.3f uA\n",
+         local_ppm,
+         central_ppm,
+         duty * 100.0,
+         duty * WW_RX_CURRENT_UA);
+  printf("  interval  latency  widening\n");
+  for (size_t i = 0; i < sizeof(intervals) / sizeof(intervals[0]); i++) {
+    for (size_t j = 0; j < sizeof(latencies) / sizeof(latencies[0]); j++) {
+      double interval_us = intervals[i] * WW_CONN_UNIT_US;
+      double widening_us = duty * interval_us * (latencies[j] + 1);
+
+      printf("  %6.1f ms  %7u  %7.1f us%s\n",
+             interval_us / 1000.0,
+             latencies[j],
+             widening_us,
+             (widening_us > interval_us / 2.0 - WW_T_IFS_US) ? "  over limit" : "");
+    }
+  }
+  printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+  unsigned long central_ppm = WW_CENTRAL_PPM_DEFAULT;
+  unsigned long local_ppm;
+  int first = 1;
+
+  if ((argc > 2) && (strcmp(argv[1], "-c") == 0)) {
+    if (parse_ppm(argv[2], &central_ppm) != 0) {
+      return 2;
+    }
+    first = 3;
+  }
+  if (first >= argc) {
+    fprintf(stderr, "usage: %s [-c <ppm>] <ppm>...\n", argv[0]);
+    return 2;
+  }
+  for (int i = first; i < argc; i++) {
+    if (parse_ppm(argv[i], &local_ppm) != 0) {
+      return 2;
+    }
+    report(central_ppm, local_ppm);
+  }
+  return 0;
+}